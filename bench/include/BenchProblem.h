@@ -0,0 +1,42 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BENCHPROBLEM_H
+#define BENCHPROBLEM_H
+
+#include "MooseApp.h"
+#include "MooseMesh.h"
+#include "FEProblem.h"
+
+/**
+ * A reproducible synthetic problem for benchmarks: a unit cube meshed with
+ * n x n x n HEX8 elements and a single first order Lagrange variable "u"
+ * initialized to a smooth field.
+ */
+class BenchProblem
+{
+public:
+  BenchProblem(unsigned int n);
+
+  MooseApp & app() { return *_app; }
+  MooseMesh & mesh() { return *_mesh; }
+  FEProblem & problem() { return *_fe_problem; }
+
+private:
+  std::unique_ptr<MooseApp> _app;
+  std::unique_ptr<MooseMesh> _mesh;
+  std::unique_ptr<FEProblem> _fe_problem;
+};
+
+#endif // BENCHPROBLEM_H
@@ -0,0 +1,31 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+#ifndef MOOSEBENCHAPP_H
+#define MOOSEBENCHAPP_H
+
+#include "MooseApp.h"
+
+class MooseBenchApp;
+
+template <>
+InputParameters validParams<MooseBenchApp>();
+
+class MooseBenchApp : public MooseApp
+{
+public:
+  MooseBenchApp(const InputParameters & parameters);
+  virtual ~MooseBenchApp();
+};
+
+#endif /* MOOSEBENCHAPP_H */
@@ -0,0 +1,131 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MOOSEBENCHMARK_H
+#define MOOSEBENCHMARK_H
+
+#include "Moose.h"
+
+// C++ includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * A minimal benchmark harness following the Google Benchmark conventions, so that the
+ * results can be consumed by the same trend tracking tools without an extra dependency.
+ *
+ * A benchmark is a function taking a MooseBenchmark::State. The timed region is the body
+ * of the keepRunning() loop, and the registered arguments are available through range():
+ *
+ *   static void
+ *   LinearInterpolationSample(MooseBenchmark::State & state)
+ *   {
+ *     // setup (not timed)
+ *     while (state.keepRunning())
+ *       MooseBenchmark::doNotOptimize(interp.sample(x));
+ *   }
+ *   MOOSE_BENCHMARK(LinearInterpolationSample)->arg(16)->arg(1024);
+ *
+ * Supported command line options are --benchmark_filter=<substring>,
+ * --benchmark_min_time=<seconds>, --benchmark_out=<file.json> and --benchmark_list.
+ */
+namespace MooseBenchmark
+{
+
+class State
+{
+public:
+  State(std::int64_t range, std::uint64_t max_iterations);
+
+  /// Returns true while the timed loop should continue
+  bool keepRunning();
+
+  /// The argument the benchmark is being run with
+  std::int64_t range() const { return _range; }
+
+  /// Number of items processed per iteration, reported as a rate in the output
+  void setItemsPerIteration(std::uint64_t items) { _items_per_iteration = items; }
+
+  std::uint64_t iterations() const { return _iterations; }
+  std::uint64_t itemsPerIteration() const { return _items_per_iteration; }
+
+  /// Wall and CPU time spent in the timed loop (s)
+  double realTime() const { return _real_time; }
+  double cpuTime() const { return _cpu_time; }
+
+private:
+  const std::int64_t _range;
+  const std::uint64_t _max_iterations;
+  std::uint64_t _iterations;
+  std::uint64_t _items_per_iteration;
+  bool _started;
+  double _real_start;
+  double _cpu_start;
+  double _real_time;
+  double _cpu_time;
+};
+
+typedef void (*Function)(State &);
+
+class Benchmark
+{
+public:
+  Benchmark(const std::string & name, Function function);
+
+  /// Adds an argument to run the benchmark with (the benchmark runs once per argument)
+  Benchmark * arg(std::int64_t value);
+
+  /// Adds arguments start, start * multiplier, ... up to and including limit
+  Benchmark * range(std::int64_t start, std::int64_t limit, std::int64_t multiplier = 8);
+
+  const std::string & name() const { return _name; }
+  Function function() const { return _function; }
+  const std::vector<std::int64_t> & args() const { return _args; }
+
+private:
+  const std::string _name;
+  const Function _function;
+  std::vector<std::int64_t> _args;
+};
+
+/// Adds a benchmark to the global registry
+Benchmark * registerBenchmark(const std::string & name, Function function);
+
+/// Runs all registered benchmarks matching the command line filter
+int runBenchmarks(int argc, char ** argv);
+
+/// Prevents the compiler from optimizing away the computation of value
+template <typename T>
+inline void
+doNotOptimize(const T & value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// Forces all pending memory writes to be visible to the compiler
+inline void
+clobberMemory()
+{
+  asm volatile("" : : : "memory");
+}
+}
+
+#define MOOSE_BENCHMARK_CONCAT_(a, b) a##b
+#define MOOSE_BENCHMARK_CONCAT(a, b) MOOSE_BENCHMARK_CONCAT_(a, b)
+#define MOOSE_BENCHMARK(function)                                                                  \
+  static MooseBenchmark::Benchmark * MOOSE_BENCHMARK_CONCAT(benchmark_, __LINE__)                 \
+      __attribute__((unused)) = MooseBenchmark::registerBenchmark(#function, function)
+
+#endif // MOOSEBENCHMARK_H
@@ -0,0 +1,181 @@
+# Frictionless penalty contact between two elastic blocks in 3D.
+# Uses the two block mesh from the combined module fieldsplit contact
+# test; the mesh size is controlled with Mesh/uniform_refine by
+# benchmarks/scaling.py.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+  volumetric_locking_correction = true
+[]
+
+[Mesh]
+  file = ../../modules/combined/test/tests/fieldsplit_contact/2blocks3d.e
+  patch_size = 5
+[]
+
+[Modules/TensorMechanics/Master]
+  [./all]
+    strain = FINITE
+    incremental = true
+    add_variables = true
+  [../]
+[]
+
+[Functions]
+  [./horizontal_movement]
+    type = ParsedFunction
+    value = t/10.0
+  [../]
+[]
+
+[BCs]
+  [./push_x]
+    type = FunctionPresetBC
+    variable = disp_x
+    boundary = 1
+    function = horizontal_movement
+  [../]
+  [./fix_x]
+    type = PresetBC
+    variable = disp_x
+    boundary = 4
+    value = 0.0
+  [../]
+  [./fix_y]
+    type = PresetBC
+    variable = disp_y
+    boundary = '1 4'
+    value = 0.0
+  [../]
+  [./fix_z]
+    type = PresetBC
+    variable = disp_z
+    boundary = '1 4'
+    value = 0.0
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 1.0e6
+    poissons_ratio = 0.3
+  [../]
+  [./stress]
+    type = ComputeFiniteStrainElasticStress
+  [../]
+[]
+
+[Contact]
+  [./leftright]
+    slave = 2
+    master = 3
+    model = frictionless
+    penalty = 1e+6
+    normalize_penalty = true
+    formulation = kinematic
+    system = constraint
+    normal_smoothing_distance = 0.1
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_asm_overlap -sub_pc_type'
+  petsc_options_value = 'asm      1               lu'
+
+  dt = 0.1
+  end_time = 0.3
+
+  l_tol = 1e-4
+  l_max_its = 100
+
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-6
+  nl_max_its = 100
+[]
+
+[Postprocessors]
+  [./dofs]
+    type = NumDOFs
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./elems]
+    type = NumElems
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./active_time]
+    type = PerformanceData
+    event = ACTIVE
+    execute_on = TIMESTEP_END
+  [../]
+  [./setup_time]
+    type = PerformanceData
+    column = total_time
+    category = Setup
+    event = initialSetup()
+    execute_on = TIMESTEP_END
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    column = total_time
+    event = solve()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./memory_total]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = total
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+  [./memory_max_rank]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+  [./penetration_time]
+    type = PerformanceData
+    column = total_time
+    event = detectPenetration()
+    execute_on = TIMESTEP_END
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
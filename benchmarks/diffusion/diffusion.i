@@ -0,0 +1,119 @@
+# Scalar diffusion with a volumetric source on a structured hex mesh.
+# The mesh size is controlled from the command line (Mesh/nx, Mesh/ny,
+# Mesh/nz or Mesh/uniform_refine) by benchmarks/scaling.py.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 20
+  ny = 20
+  nz = 20
+  elem_type = HEX8
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    value = 1
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = DirichletBC
+    variable = u
+    boundary = 'left right top bottom front back'
+    value = 0
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+
+  l_tol = 1e-8
+  nl_rel_tol = 1e-10
+[]
+
+[Postprocessors]
+  [./dofs]
+    type = NumDOFs
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./elems]
+    type = NumElems
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./active_time]
+    type = PerformanceData
+    event = ACTIVE
+    execute_on = TIMESTEP_END
+  [../]
+  [./setup_time]
+    type = PerformanceData
+    column = total_time
+    category = Setup
+    event = initialSetup()
+    execute_on = TIMESTEP_END
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    column = total_time
+    event = solve()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./memory_total]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = total
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+  [./memory_max_rank]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
@@ -0,0 +1,179 @@
+# Transient diffusion master driving a grid of sub-applications through
+# a TransientMultiApp with field transfers in both directions. The number
+# of sub-applications is set with MultiApps/sub/positions and the mesh
+# size with Mesh/uniform_refine by benchmarks/scaling.py.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 40
+  ny = 40
+  xmax = 4
+  ymax = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./coupled]
+    type = CoupledForce
+    variable = u
+    v = v
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+
+  num_steps = 5
+  dt = 0.1
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_end
+    positions = '0.5 0.5 0  1.5 0.5 0  2.5 0.5 0  3.5 0.5 0
+                 0.5 1.5 0  1.5 1.5 0  2.5 1.5 0  3.5 1.5 0
+                 0.5 2.5 0  1.5 2.5 0  2.5 2.5 0  3.5 2.5 0
+                 0.5 3.5 0  1.5 3.5 0  2.5 3.5 0  3.5 3.5 0'
+    input_files = sub.i
+  [../]
+[]
+
+[Transfers]
+  [./to_sub]
+    type = MultiAppMeshFunctionTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = u_master
+  [../]
+  [./from_sub]
+    type = MultiAppMeshFunctionTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = v
+    variable = v
+  [../]
+[]
+
+[Postprocessors]
+  [./dofs]
+    type = NumDOFs
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./elems]
+    type = NumElems
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./active_time]
+    type = PerformanceData
+    event = ACTIVE
+    execute_on = TIMESTEP_END
+  [../]
+  [./setup_time]
+    type = PerformanceData
+    column = total_time
+    category = Setup
+    event = initialSetup()
+    execute_on = TIMESTEP_END
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    column = total_time
+    event = solve()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./memory_total]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = total
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+  [./memory_max_rank]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+  [./multiapp_time]
+    type = PerformanceData
+    column = total_time
+    category = Setup
+    event = execMultiApps()
+    execute_on = TIMESTEP_END
+  [../]
+  [./transfer_time]
+    type = PerformanceData
+    column = total_time
+    category = Setup
+    event = execTransfers()
+    execute_on = TIMESTEP_END
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
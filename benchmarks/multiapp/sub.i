@@ -0,0 +1,55 @@
+# Sub-application for benchmarks/multiapp/master.i: a unit square that
+# reacts to the transferred master field.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = -0.5
+  xmax = 0.5
+  ymin = -0.5
+  ymax = 0.5
+[]
+
+[Variables]
+  [./v]
+  [../]
+[]
+
+[AuxVariables]
+  [./u_master]
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = v
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = v
+  [../]
+  [./coupled]
+    type = CoupledForce
+    variable = v
+    v = u_master
+  [../]
+  [./reaction]
+    type = Reaction
+    variable = v
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = false
+[]
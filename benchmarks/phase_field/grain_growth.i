@@ -0,0 +1,191 @@
+# Isotropic grain growth from a Voronoi tessellation with the grain
+# tracker remapping a fixed number of order parameters. The mesh size is
+# controlled from the command line by benchmarks/scaling.py.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 100
+  ny = 100
+  xmax = 1000
+  ymax = 1000
+  elem_type = QUAD4
+[]
+
+[GlobalParams]
+  op_num = 8
+  var_name_base = gr
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi]
+    type = PolycrystalVoronoi
+    rand_seed = 105
+    grain_num = 40
+    coloring_algorithm = bt
+  [../]
+  [./grain_tracker]
+    type = GrainTracker
+    threshold = 0.2
+    connecting_threshold = 0.08
+    compute_halo_maps = true
+    polycrystal_ic_uo = voronoi
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalColoringIC]
+      polycrystal_ic_uo = voronoi
+    [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./bnds]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./PolycrystalKernel]
+  [../]
+[]
+
+[AuxKernels]
+  [./BndsCalc]
+    type = BndsCalcAux
+    variable = bnds
+    execute_on = timestep_end
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./All]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./Copper]
+    type = GBEvolution
+    T = 500 # K
+    wGB = 60 # nm
+    GBmob0 = 2.5e-6 #m^4/(Js) from Schoenfelder 1997
+    Q = 0.23 #Migration energy in eV
+    GBenergy = 0.708 #GB energy in J/m^2
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = 'bdf2'
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type -ksp_gmres_restart'
+  petsc_options_value = 'hypre boomeramg 31'
+  l_tol = 1.0e-4
+  l_max_its = 30
+  nl_max_its = 20
+  nl_rel_tol = 1.0e-9
+
+  num_steps = 5
+  dt = 20.0
+[]
+
+[Postprocessors]
+  [./dofs]
+    type = NumDOFs
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./elems]
+    type = NumElems
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./active_time]
+    type = PerformanceData
+    event = ACTIVE
+    execute_on = TIMESTEP_END
+  [../]
+  [./setup_time]
+    type = PerformanceData
+    column = total_time
+    category = Setup
+    event = initialSetup()
+    execute_on = TIMESTEP_END
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    column = total_time
+    event = solve()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./memory_total]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = total
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+  [./memory_max_rank]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+  [./grain_tracker_time]
+    type = PerformanceData
+    column = total_time
+    category = GrainTracker
+    event = execute()
+    execute_on = TIMESTEP_END
+  [../]
+  [./grains]
+    type = FeatureFloodCount
+    variable = bnds
+    threshold = 0.7
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
@@ -0,0 +1,231 @@
+#!/usr/bin/env python
+"""
+Runs the inputs under benchmarks/ over a sweep of MPI ranks, threads and
+mesh sizes and writes a scaling report.
+
+Every benchmark input reports its own timing and memory through the
+PerformanceData, MemoryUsage, NumDOFs and NumElems postprocessors, so the
+driver only has to launch the executable and read the final row of the
+CSV output.
+
+Examples:
+  ./scaling.py --cases diffusion --ranks 1 2 4 8 --sizes 40
+  ./scaling.py --mode weak --ranks 1 8 64 --threads 1 2
+  ./scaling.py --cases contact --sizes 0 1 2 --dry-run
+"""
+from __future__ import print_function, division
+import os, sys, csv, math, time, argparse, subprocess
+
+BENCHMARK_DIR = os.path.dirname(os.path.abspath(__file__))
+MOOSE_DIR = os.environ.get('MOOSE_DIR', os.path.dirname(BENCHMARK_DIR))
+
+# Each case names its input, the application that can run it and how the
+# "size" parameter is turned into command line arguments. 'base' is the
+# size used for one process in weak scaling mode.
+CASES = {
+    'diffusion' : { 'input' : 'diffusion/diffusion.i',
+                    'app' : 'test',
+                    'dim' : 3,
+                    'base' : 20,
+                    'size' : lambda n: ['Mesh/nx=%d' % n, 'Mesh/ny=%d' % n, 'Mesh/nz=%d' % n] },
+    'plasticity' : { 'input' : 'tensor_mechanics/plasticity.i',
+                     'app' : 'combined',
+                     'dim' : 3,
+                     'base' : 10,
+                     'size' : lambda n: ['Mesh/nx=%d' % n, 'Mesh/ny=%d' % n, 'Mesh/nz=%d' % n] },
+    'contact' : { 'input' : 'contact/contact.i',
+                  'app' : 'combined',
+                  'dim' : 3,
+                  'base' : 0,
+                  'refine' : True,
+                  'size' : lambda n: ['Mesh/uniform_refine=%d' % n] },
+    'grain_growth' : { 'input' : 'phase_field/grain_growth.i',
+                       'app' : 'combined',
+                       'dim' : 2,
+                       'base' : 100,
+                       'size' : lambda n: ['Mesh/nx=%d' % n, 'Mesh/ny=%d' % n] },
+    'multiapp' : { 'input' : 'multiapp/master.i',
+                   'app' : 'test',
+                   'dim' : 2,
+                   'base' : 40,
+                   'size' : lambda n: ['Mesh/nx=%d' % n, 'Mesh/ny=%d' % n] },
+}
+
+# Postprocessor columns copied into the report, in order
+COLUMNS = ['dofs', 'elems', 'active_time', 'setup_time', 'solve_time', 'residual_time',
+           'residual_calls', 'jacobian_time', 'jacobian_calls', 'memory_total', 'memory_max_rank']
+
+def executable(case, method):
+    """ Returns the path to the executable that runs the given case """
+    if CASES[case]['app'] == 'test':
+        return os.path.join(MOOSE_DIR, 'test', 'moose_test-' + method)
+    return os.path.join(MOOSE_DIR, 'modules', 'combined', 'combined-' + method)
+
+def weakSize(case, procs):
+    """ Scales the base size so that the work per process stays constant """
+    spec = CASES[case]
+    if spec.get('refine', False):
+        return spec['base'] + int(round(math.log(procs) / math.log(2 ** spec['dim'])))
+    return int(round(spec['base'] * procs ** (1.0 / spec['dim'])))
+
+def readLastRow(filename):
+    """ Returns the final row of a MOOSE postprocessor CSV file as a dict """
+    with open(filename) as f:
+        rows = list(csv.DictReader(f))
+    if not rows:
+        return {}
+    return dict((key, float(value)) for key, value in rows[-1].items() if value)
+
+def runCase(case, ranks, threads, size, options):
+    """ Launches a single run and returns its record, or None on failure """
+    spec = CASES[case]
+    input_file = os.path.join(BENCHMARK_DIR, spec['input'])
+    tag = '%s_n%d_t%d_s%d' % (case, ranks, threads, size)
+    file_base = os.path.join(os.path.abspath(options.output), tag)
+
+    cmd = []
+    if ranks > 1 or options.always_mpi:
+        cmd += options.mpiexec.split() + ['-n', str(ranks)]
+    cmd += [executable(case, options.method), '-i', os.path.basename(input_file)]
+    if threads > 1:
+        cmd += ['--n-threads=%d' % threads]
+    cmd += spec['size'](size)
+    cmd += ['Outputs/file_base=' + file_base]
+    cmd += options.cli_args
+
+    print(' '.join(cmd))
+    if options.dry_run:
+        return None
+
+    best = None
+    for i in range(options.repeat):
+        start = time.time()
+        with open(file_base + '.log', 'w') as log:
+            status = subprocess.call(cmd, cwd=os.path.dirname(input_file), stdout=log,
+                                     stderr=subprocess.STDOUT)
+        wall = time.time() - start
+        if status != 0:
+            print('  failed with status %d, see %s.log' % (status, file_base))
+            return None
+
+        data = readLastRow(file_base + '.csv')
+        if best is None or data.get('solve_time', wall) < best.get('solve_time', best['wall']):
+            data['wall'] = wall
+            best = data
+
+    record = { 'case' : case, 'ranks' : ranks, 'threads' : threads, 'size' : size }
+    record['wall'] = best['wall']
+    for column in COLUMNS:
+        record[column] = best.get(column, float('nan'))
+    print('  wall %.2fs solve %.2fs' % (record['wall'], record['solve_time']))
+    return record
+
+def addEfficiency(records, mode):
+    """
+    Adds speedup and parallel efficiency for each record relative to the run
+    with the fewest processes: at the same size in strong scaling mode and for
+    the same case in weak scaling mode.
+    """
+    groups = {}
+    for record in records:
+        key = (record['case'], record['size']) if mode == 'strong' else record['case']
+        groups.setdefault(key, []).append(record)
+
+    for group in groups.values():
+        base = min(group, key=lambda r: r['ranks'] * r['threads'])
+        base_procs = base['ranks'] * base['threads']
+        for record in group:
+            procs = record['ranks'] * record['threads']
+            ratio = base['solve_time'] / record['solve_time'] if record['solve_time'] > 0 else float('nan')
+            if mode == 'strong':
+                record['speedup'] = ratio
+                record['efficiency'] = ratio * base_procs / procs
+            else:
+                record['speedup'] = ratio * procs / base_procs
+                record['efficiency'] = ratio
+
+def writeReport(records, options):
+    """ Writes the CSV and markdown scaling reports """
+    fields = ['case', 'ranks', 'threads', 'size', 'wall'] + COLUMNS + ['speedup', 'efficiency']
+    csv_name = os.path.join(options.output, 'scaling_report.csv')
+    with open(csv_name, 'w') as f:
+        writer = csv.DictWriter(f, fieldnames=fields)
+        writer.writeheader()
+        for record in records:
+            writer.writerow(record)
+
+    md_name = os.path.join(options.output, 'scaling_report.md')
+    with open(md_name, 'w') as f:
+        f.write('# %s scaling report\n\n' % options.mode.capitalize())
+        f.write('Executable method: %s\n\n' % options.method)
+        for case in sorted(set(r['case'] for r in records)):
+            f.write('## %s\n\n' % case)
+            f.write('| ranks | threads | size | DOFs | wall (s) | setup (s) | solve (s) | '
+                    'residual (s) | jacobian (s) | max rank memory (MB) | speedup | efficiency |\n')
+            f.write('|' + '---|' * 12 + '\n')
+            for r in sorted((r for r in records if r['case'] == case),
+                            key=lambda r: (r['size'], r['ranks'] * r['threads'], r['threads'])):
+                f.write('| %d | %d | %d | %d | %.2f | %.2f | %.2f | %.2f | %.2f | %.1f | %.2f | %.2f |\n'
+                        % (r['ranks'], r['threads'], r['size'], r['dofs'], r['wall'], r['setup_time'],
+                           r['solve_time'], r['residual_time'], r['jacobian_time'],
+                           r['memory_max_rank'] / 2 ** 20, r['speedup'], r['efficiency']))
+            f.write('\n')
+
+    print('Wrote %s and %s' % (csv_name, md_name))
+
+def main():
+    parser = argparse.ArgumentParser(description='Sweep the MOOSE benchmark inputs over ranks, '
+                                     'threads and mesh sizes and write a scaling report.')
+    parser.add_argument('--cases', nargs='+', choices=sorted(CASES.keys()),
+                        default=sorted(CASES.keys()), help='The benchmark cases to run')
+    parser.add_argument('--mode', choices=['strong', 'weak'], default='strong',
+                        help='Strong scaling keeps the size fixed; weak scaling grows it '
+                        'with the number of processes')
+    parser.add_argument('--ranks', nargs='+', type=int, default=[1, 2, 4], help='MPI rank counts')
+    parser.add_argument('--threads', nargs='+', type=int, default=[1], help='Thread counts per rank')
+    parser.add_argument('--sizes', nargs='+', type=int,
+                        help='Mesh sizes for strong scaling (elements per side, or refinement '
+                        'levels for file based meshes); defaults to each case\'s base size')
+    parser.add_argument('--method', default=os.environ.get('METHOD', 'opt'),
+                        help='The executable method suffix')
+    parser.add_argument('--mpiexec', default='mpiexec', help='The MPI launcher')
+    parser.add_argument('--always-mpi', action='store_true',
+                        help='Use the MPI launcher for single rank runs too')
+    parser.add_argument('--repeat', type=int, default=1,
+                        help='Number of repetitions per configuration; the fastest is kept')
+    parser.add_argument('--output', default='scaling_results', help='The output directory')
+    parser.add_argument('--dry-run', action='store_true', help='Print the commands without running them')
+    parser.add_argument('cli_args', nargs=argparse.REMAINDER,
+                        help='Extra command line arguments passed to every run')
+    options = parser.parse_args()
+    if options.cli_args and options.cli_args[0] == '--':
+        options.cli_args = options.cli_args[1:]
+
+    if not os.path.isdir(options.output):
+        os.makedirs(options.output)
+
+    records = []
+    for case in options.cases:
+        for ranks in options.ranks:
+            for threads in options.threads:
+                if options.mode == 'weak':
+                    sizes = [weakSize(case, ranks * threads)]
+                else:
+                    sizes = options.sizes if options.sizes else [CASES[case]['base']]
+                for size in sizes:
+                    record = runCase(case, ranks, threads, size, options)
+                    if record is not None:
+                        records.append(record)
+
+    if options.dry_run:
+        return 0
+    if not records:
+        print('No benchmark completed successfully')
+        return 1
+
+    addEfficiency(records, options.mode)
+    writeReport(records, options)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,179 @@
+# J2 plasticity with isotropic hardening under uniaxial compression.
+# The return map is evaluated at every quadrature point, so this case
+# stresses material evaluation rather than the linear solver. The mesh
+# size is controlled from the command line by benchmarks/scaling.py.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  nz = 10
+  xmin = -0.5
+  xmax = 0.5
+  ymin = -0.5
+  ymax = 0.5
+  zmin = -0.5
+  zmax = 0.5
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./TensorMechanics]
+  [../]
+[]
+
+[BCs]
+  [./x]
+    type = FunctionPresetBC
+    variable = disp_x
+    boundary = 'left right'
+    function = '-1E-6*x*t'
+  [../]
+  [./y]
+    type = PresetBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./z]
+    type = PresetBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  [../]
+[]
+
+[UserObjects]
+  [./str]
+    type = TensorMechanicsHardeningCubic
+    value_0 = 2
+    value_residual = 4
+    internal_limit = 1E-5
+  [../]
+  [./j2]
+    type = TensorMechanicsPlasticJ2
+    yield_strength = str
+    yield_function_tolerance = 1E-3
+    internal_constraint_tolerance = 1E-9
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+    fill_method = symmetric_isotropic
+    C_ijkl = '0 1E6'
+  [../]
+  [./strain]
+    type = ComputeFiniteStrain
+  [../]
+  [./mc]
+    type = ComputeMultiPlasticityStress
+    ep_plastic_tolerance = 1E-9
+    plastic_models = j2
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-8
+
+  dt = 1
+  end_time = 5
+[]
+
+[Postprocessors]
+  [./dofs]
+    type = NumDOFs
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./elems]
+    type = NumElems
+    execute_on = 'INITIAL TIMESTEP_END'
+  [../]
+  [./active_time]
+    type = PerformanceData
+    event = ACTIVE
+    execute_on = TIMESTEP_END
+  [../]
+  [./setup_time]
+    type = PerformanceData
+    column = total_time
+    category = Setup
+    event = initialSetup()
+    execute_on = TIMESTEP_END
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    column = total_time
+    event = solve()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./residual_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_residual()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    column = total_time
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./jacobian_calls]
+    type = PerformanceData
+    column = n_calls
+    event = compute_jacobian()
+    execute_on = TIMESTEP_END
+  [../]
+  [./memory_total]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = total
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+  [./memory_max_rank]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    execute_on = 'INITIAL TIMESTEP_END NONLINEAR LINEAR'
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
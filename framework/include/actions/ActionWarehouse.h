@@ -172,6 +172,24 @@ public:
 
   void showParser(bool state = true) { _show_parser = state; }
 
+  /**
+   * Enables the collection of wall time and resident memory changes for every executed Action.
+   * A summary is printed to the console once all actions have been executed.
+   * @param state Flag indicating whether to time the actions.
+   * @param json_file When not empty, the complete timing data is also written to this file.
+   */
+  void showActionTiming(bool state = true, const std::string & json_file = "")
+  {
+    _show_action_timing = state;
+    _action_timing_file = json_file;
+  }
+
+  /**
+   * Prints the per-task totals and the slowest individual actions collected while
+   * showActionTiming() is enabled and writes the JSON report if a file was requested.
+   */
+  void printActionTiming() const;
+
   //// Getters
   Syntax & syntax() { return _syntax; }
 
@@ -225,6 +243,25 @@ protected:
   // DEBUGGING
   bool _show_actions;
   bool _show_parser;
+  bool _show_action_timing;
+
+  /// File that receives the action timing data in JSON format (empty for none)
+  std::string _action_timing_file;
+
+  /// The time and memory spent in a single call to Action::act()
+  struct ActionTiming
+  {
+    std::string task;
+    std::string type;
+    std::string name;
+    /// Wall time in seconds
+    double time;
+    /// Change of the resident set size in bytes
+    long memory;
+  };
+
+  /// The timing data for every Action executed while timing was enabled
+  std::vector<ActionTiming> _action_timings;
 
   // When executing the actions in the warehouse, this string will always contain
   // the current task name
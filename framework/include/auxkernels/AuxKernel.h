@@ -88,6 +88,11 @@ public:
    */
   bool isNodal();
 
+  /**
+   * Whether this kernel is only computed on the steps on which an output writes its variable
+   */
+  bool outputOnly() const { return _output_only; }
+
   const std::set<std::string> & getDependObjects() const { return _depend_uo; }
 
   void coupledCallback(const std::string & var_name, bool is_old) override;
@@ -150,6 +155,8 @@ protected:
   bool _nodal;
   /// true if the kernel is boundary kernel, false if it is interior kernels
   bool _bnd;
+  /// true if the kernel is only computed when its variable is going to be output
+  const bool _output_only;
   /// Mesh this kernel is active on
   MooseMesh & _mesh;
   /// Dimension of the problem being solved
@@ -224,7 +224,7 @@ public:
 
   /**
    * Get an ErrorVector that will be filled up with values corresponding to the
-   * indicator field name passed in.
+   * indicator field name passed in. Only the entries of the active local elements are filled.
    *
    * Note that this returns a reference... and the return value should be stored as a reference!
    *
@@ -243,6 +243,15 @@ public:
   bool isAdaptivityDue();
 
 protected:
+  /**
+   * Fill marker_values, indexed by element id, with the value of the marker
+   * field on every active element. Each processor only reads the marker
+   * values of its own elements, which are then summed over the processors, so
+   * only one value per element is communicated instead of the whole
+   * auxiliary solution.
+   */
+  void gatherMarkerValues(const std::string & marker_name, std::vector<Number> & marker_values);
+
   FEProblemBase & _subproblem;
   MooseMesh & _mesh;
 
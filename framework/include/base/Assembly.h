@@ -24,6 +24,9 @@
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/fe_type.h"
 
+#include <list>
+#include <set>
+
 // libMesh forward declarations
 namespace libMesh
 {
@@ -52,6 +55,7 @@ class ArbitraryQuadrature;
 class SystemBase;
 class MooseVariable;
 class XFEMInterface;
+class CSRMatrixCache;
 typedef MooseArray<std::vector<Real>> VariablePhiValue;
 typedef MooseArray<std::vector<RealGradient>> VariablePhiGradient;
 typedef MooseArray<std::vector<RealTensor>> VariablePhiSecond;
@@ -386,6 +390,42 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Whether this assembly keeps separate volume FE objects for each element type.  On meshes
+   * mixing element types the FE objects then keep their shape functions on the reference element
+   * when the element type changes.  The objects returned by getFE() are swapped whenever the type
+   * changes, so data pointers obtained from them must not be kept.
+   *
+   * @param fe_pool True for using the pool false for not.
+   */
+  void useFEPool(bool fe_pool) { _use_fe_pool = fe_pool; }
+
+  /**
+   * Set the limits of the FE shape function cache.
+   *
+   * @param memory_limit The memory budget of this cache in bytes, 0 for no limit.  Once it is
+   * reached stale entries are evicted (least recently used first) to make room for new elements;
+   * valid entries are kept and elements that don't fit are simply not cached.
+   * @param blocks The subdomains the cache is used on, empty for all subdomains.
+   */
+  void setFECacheLimits(std::size_t memory_limit, const std::set<SubdomainID> & blocks);
+
+  /**
+   * Number of volume reinits that were served from / not served from the FE cache since the last
+   * call to resetFECacheStatistics().
+   */
+  unsigned long int feCacheHits() const { return _fe_cache_hits; }
+  unsigned long int feCacheMisses() const { return _fe_cache_misses; }
+
+  /// Approximate number of bytes currently held by the FE cache
+  std::size_t feCacheMemory() const { return _fe_cache_memory; }
+
+  void resetFECacheStatistics()
+  {
+    _fe_cache_hits = 0;
+    _fe_cache_misses = 0;
+  }
+
   void prepare();
   void prepareNonlocal();
 
@@ -501,6 +541,12 @@ public:
    */
   void addCachedJacobian(SparseMatrix<Number> & jacobian);
 
+  /**
+   * While set, addCachedJacobian() accumulates the values into \p cache instead of adding them
+   * one at a time, when the cache holds the sparsity pattern of the matrix.  Pass NULL to unset.
+   */
+  void setJacobianCSRCache(CSRMatrixCache * cache) { _csr_jacobian = cache; }
+
   DenseVector<Number> & residualBlock(unsigned int var_num,
                                       Moose::KernelType type = Moose::KT_NONTIME)
   {
@@ -525,6 +571,25 @@ public:
                                   const std::vector<dof_id_type> & jdof_indices,
                                   Real scaling_factor);
 
+  /// A copy of an element Jacobian block, see saveJacobianBlocks()
+  struct SavedJacobianBlock
+  {
+    unsigned int ivar;
+    unsigned int jvar;
+    DenseMatrix<Number> values;
+  };
+
+  /**
+   * Copies the element Jacobian blocks that are currently in use into \p blocks
+   */
+  void saveJacobianBlocks(std::vector<SavedJacobianBlock> & blocks) const;
+
+  /**
+   * Adds element Jacobian blocks copied with saveJacobianBlocks() on the same element to the
+   * current ones
+   */
+  void addSavedJacobianBlocks(const std::vector<SavedJacobianBlock> & blocks);
+
   std::vector<std::pair<MooseVariable *, MooseVariable *>> & couplingEntries() { return _cm_entry; }
   std::vector<std::pair<MooseVariable *, MooseVariable *>> & nonlocalCouplingEntries()
   {
@@ -568,6 +633,12 @@ public:
    */
   void invalidateCache();
 
+  /**
+   * Release the storage of the cached residual and Jacobian values (see cacheResidual() and
+   * cacheJacobian()) and forget their high-water marks, e.g. after the mesh changed.
+   */
+  void releaseCachedStorage();
+
   std::map<FEType, bool> _need_second_derivative;
 
   /**
@@ -595,6 +666,12 @@ public:
    */
   void addCachedJacobianContributions(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Estimate of the bytes held by the local residual and Jacobian blocks and by the cached
+   * residual and Jacobian entries
+   */
+  std::size_t memoryFootprint() const;
+
   /**
    * Set the pointer to the XFEM controller object
    */
@@ -608,6 +685,14 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * Swap the volume FE objects of the element's dimension for the ones of its element type,
+   * see useFEPool().
+   *
+   * @param elem The element we are about to reinit on
+   */
+  void swapPooledFE(const Elem * elem);
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -688,6 +773,8 @@ protected:
 
   /// The XFEM controller
   std::shared_ptr<XFEMInterface> _xfem;
+  /// Reused storage for the XFEM quadrature weight multipliers of the current elem
+  MooseArray<Real> _xfem_weight_multipliers;
 
   /// The "volume" fe object that matches the current elem
   std::map<FEType, FEBase *> _current_fe;
@@ -702,6 +789,12 @@ protected:
 
   /// Each dimension's actual fe objects indexed on type
   std::map<unsigned int, std::map<FEType, FEBase *>> _fe;
+  /// Whether separate volume fe objects are used for each element type, see useFEPool()
+  bool _use_fe_pool;
+  /// The volume fe objects of the element types not currently in _fe: [dim][elem type][fe type]
+  std::map<unsigned int, std::map<ElemType, std::map<FEType, FEBase *>>> _fe_pool;
+  /// The element type the fe objects in _fe belong to, for each dimension
+  std::map<unsigned int, ElemType> _fe_pool_elem_type;
   /// Each dimension's helper objects
   std::map<unsigned int, FEBase **> _holder_fe_helper;
   /// The current helper object for transforming coordinates
@@ -860,21 +953,29 @@ protected:
 
   /**
    * Ok - here's the design.  One ElementFEShapeData class will be stored per element in
-   * _fe_shape_data_cache.
+   * _element_fe_shape_data_cache, indexed by element id.
    * When reinit() is called on an element we will retrieve the ElementFEShapeData class associated
-   * with that
-   * element.  If it's NULL we'll make one.  Then we'll store a copy of the shape functions computed
-   * on that
-   * element within shape_data and JxW and q_points within ElementFEShapeData.
+   * with that element.  If it's NULL we'll make one (if the memory budget allows it).  Then we'll
+   * store a copy of the shape functions computed on that element within shape_data and JxW and
+   * q_points within ElementFEShapeData.
    */
   class ElementFEShapeData
   {
   public:
+    ElementFEShapeData() : _generation(0), _memory(0) {}
+    ~ElementFEShapeData();
+
     /// This is where the cached shape functions will be held
     std::map<FEType, FEShapeData *> _shape_data;
 
-    /// Whether or not this data is invalid (needs to be recached) note that there is no constructor so the value is invalid the first time through and must be set.
-    bool _invalidated;
+    /// Cache generation this data was computed in, it is stale if this differs from the current one
+    unsigned int _generation;
+
+    /// Approximate number of bytes held by this entry
+    std::size_t _memory;
+
+    /// Position of this entry in the LRU list
+    std::list<dof_id_type>::iterator _lru_position;
 
     /// Cached JxW
     MooseArray<Real> _JxW;
@@ -883,8 +984,36 @@ protected:
     MooseArray<Point> _q_points;
   };
 
-  /// Cached shape function values stored by element
-  std::map<dof_id_type, ElementFEShapeData *> _element_fe_shape_data_cache;
+  /**
+   * Retrieve (and possibly create) the cache entry for the element, nullptr is returned if the
+   * element should not be cached.
+   */
+  ElementFEShapeData * feCacheEntry(const Elem * elem);
+
+  /// Remove the cache entry for the element id and free its memory
+  void evictFECacheEntry(dof_id_type elem_id);
+
+  /// Cached shape function values stored by element id (nullptr when not cached)
+  std::vector<ElementFEShapeData *> _element_fe_shape_data_cache;
+
+  /// Ids of the cached elements, most recently used first
+  std::list<dof_id_type> _fe_cache_lru;
+
+  /// The current cache generation, incremented every time the cache is invalidated
+  unsigned int _fe_cache_generation;
+
+  /// Memory budget for the cache of this thread in bytes (0 for no limit)
+  std::size_t _fe_cache_memory_limit;
+
+  /// Approximate number of bytes currently held by the cache
+  std::size_t _fe_cache_memory;
+
+  /// Subdomains for which the cache is used (empty for all)
+  std::set<SubdomainID> _fe_cache_blocks;
+
+  /// Number of reinits served from / not served from the cache
+  unsigned long int _fe_cache_hits;
+  unsigned long int _fe_cache_misses;
 
   /// Whether or not fe cache should be built at all
   bool _should_use_fe_cache;
@@ -915,6 +1044,9 @@ protected:
 
   unsigned int _max_cached_jacobians;
 
+  /// The sparsity pattern addCachedJacobian() accumulates into, see setJacobianCSRCache()
+  CSRMatrixCache * _csr_jacobian;
+
   /// Will be true if our preconditioning matrix is a block-diagonal matrix.  Which means that we can take some shortcuts.
   unsigned int _block_diagonal_matrix;
 
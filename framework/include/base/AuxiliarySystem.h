@@ -165,7 +165,19 @@ public:
 
   virtual void setPreviousNewtonSolution();
 
+  /**
+   * Whether the "output_only" AuxKernels of a variable are skipped in the current compute()
+   * @param var_num The number of the auxiliary variable
+   */
+  bool outputOnlySkipped(unsigned int var_num) const;
+
 protected:
+  /**
+   * Decide which variables computed by "output_only" AuxKernels are needed on this execution
+   * @param type The execution flag being computed
+   */
+  void updateOutputOnlySkipped(ExecFlagType type);
+
   void computeScalarVars(ExecFlagType type);
   void computeNodalVars(ExecFlagType type);
   void computeElementalVars(ExecFlagType type);
@@ -182,8 +194,8 @@ protected:
   NumericVector<Number> * _solution_previous_nl;
   /// Time integrator
   std::shared_ptr<TimeIntegrator> _time_integrator;
-  /// solution vector for u^dot
-  NumericVector<Number> & _u_dot;
+  /// solution vector for u^dot, only allocated for transient problems
+  NumericVector<Number> * _u_dot;
 
   /// Whether or not a copy of the residual needs to be made
   bool _need_serialized_solution;
@@ -201,6 +213,9 @@ protected:
   // Storage for AuxKernel objects
   ExecuteMooseObjectWarehouse<AuxKernel> _elemental_aux_storage;
 
+  /// Per variable number, whether its "output_only" AuxKernels are skipped in this compute()
+  std::vector<bool> _output_only_skipped;
+
   friend class AuxKernel;
   friend class ComputeNodalAuxVarsThread;
   friend class ComputeNodalAuxBcsThread;
@@ -42,6 +42,8 @@ public:
   virtual void subdomainChanged() override;
   virtual void pre() override;
   virtual void onElement(const Elem * elem) override;
+  virtual bool needInternalSides(SubdomainID /*subdomain*/) override { return false; }
+  virtual bool needInterfaces() override { return false; }
   virtual void postElement(const Elem * /*elem*/) override;
   virtual void post() override;
 
@@ -40,6 +40,8 @@ public:
 
   virtual void subdomainChanged() override;
   virtual void onElement(const Elem * elem) override;
+  virtual bool needInternalSides(SubdomainID /*subdomain*/) override { return false; }
+  virtual bool needInterfaces() override { return false; }
   virtual void post() override;
 
   void join(const ComputeElemAuxVarsThread & /*y*/);
@@ -51,6 +53,12 @@ protected:
   const MooseObjectWarehouse<AuxKernel> & _aux_kernels;
 
   bool _need_materials;
+
+  ///@{
+  /// The computed values of this thread, inserted into the solution at once in post()
+  std::vector<dof_id_type> _dof_indices;
+  std::vector<Number> _values;
+  ///@}
 };
 
 #endif // COMPUTEELEMAUXVARSTHREAD_H
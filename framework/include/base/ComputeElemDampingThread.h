@@ -24,6 +24,7 @@
 // Forward declarations
 class NonlinearSystemBase;
 class ElementDamper;
+class MooseVariable;
 template <typename T>
 class MooseObjectWarehouse;
 
@@ -37,7 +38,11 @@ public:
 
   virtual ~ComputeElemDampingThread();
 
+  virtual void subdomainChanged() override;
   virtual void onElement(const Elem * elem) override;
+  virtual void post() override;
+  virtual bool needInternalSides(SubdomainID /*subdomain*/) override { return false; }
+  virtual bool needInterfaces() override { return false; }
 
   void join(const ComputeElemDampingThread & y);
 
@@ -47,6 +52,9 @@ protected:
   Real _damping;
   NonlinearSystemBase & _nl;
   const MooseObjectWarehouse<ElementDamper> & _element_dampers;
+
+  /// The variables of the active dampers, the only ones reinitialized on each element
+  std::set<MooseVariable *> _damped_vars;
 };
 
 #endif // COMPUTEELEMDAMPINGTHREAD_H
@@ -44,6 +44,8 @@ public:
   virtual void onElement(const Elem * elem) override;
   virtual void onBoundary(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void onInternalSide(const Elem * elem, unsigned int side) override;
+  virtual bool needInternalSides(SubdomainID subdomain) override;
+  virtual bool needInterfaces() override;
   virtual void postElement(const Elem * /*elem*/) override;
   virtual void post() override;
 
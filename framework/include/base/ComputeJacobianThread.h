@@ -27,6 +27,7 @@ class IntegratedBC;
 class DGKernel;
 class InterfaceKernel;
 class KernelWarehouse;
+class KernelBase;
 
 class ComputeJacobianThread : public ThreadedElementLoop<ConstElemRange>
 {
@@ -44,12 +45,20 @@ public:
   virtual void onElement(const Elem * elem) override;
   virtual void onBoundary(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void onInternalSide(const Elem * elem, unsigned int side) override;
+  virtual bool needInternalSides(SubdomainID subdomain) override;
+  virtual bool needInterfaces() override;
   virtual void onInterface(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void postElement(const Elem * /*elem*/) override;
   virtual void post() override;
 
   void join(const ComputeJacobianThread & /*y*/);
 
+  /**
+   * Add each element Jacobian straight to the matrix instead of caching it.  Only valid while the
+   * loop runs over elements that share no node, see MooseMesh::getActiveLocalElementColorRanges()
+   */
+  void assembleColored(bool colored) { _colored = colored; }
+
 protected:
   SparseMatrix<Number> & _jacobian;
   NonlinearSystemBase & _nl;
@@ -70,6 +79,21 @@ protected:
 
   Moose::KernelType _kernel_type;
 
+  /// The Kernels evaluated by computeJacobian(), see NonlinearSystemBase::useConstantJacobian()
+  enum class KernelSelection
+  {
+    ALL,
+    CONSTANT,
+    NONCONSTANT
+  };
+  KernelSelection _kernel_selection;
+
+  /// Whether the element Jacobians are added without locks, see assembleColored()
+  bool _colored;
+
+  /// Whether or not \p kernel contributes to the element Jacobian being computed
+  bool computesJacobian(const KernelBase & kernel) const;
+
   virtual void computeJacobian();
   virtual void computeFaceJacobian(BoundaryID bnd_id);
   virtual void computeInternalFaceJacobian(const Elem * neighbor);
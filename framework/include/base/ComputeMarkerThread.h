@@ -36,6 +36,8 @@ public:
   virtual void onElement(const Elem * elem) override;
   virtual void onBoundary(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void onInternalSide(const Elem * elem, unsigned int side) override;
+  virtual bool needInternalSides(SubdomainID /*subdomain*/) override { return false; }
+  virtual bool needInterfaces() override { return false; }
   virtual void postElement(const Elem * /*elem*/) override;
   virtual void post() override;
 
@@ -39,15 +39,36 @@ public:
 
   virtual void onNode(ConstNodeRange::const_iterator & node_it) override;
 
+  virtual void post() override;
+
   void join(const ComputeNodalKernelsThread & /*y*/);
 
 protected:
+  /// The nodes gathered for a nodal kernel computing block residuals
+  struct NodalBlock
+  {
+    std::vector<const Node *> nodes;
+    std::vector<dof_id_type> dofs;
+  };
+
+  /// Computes and caches the residuals of \p kernel on the nodes of \p block, then clears it
+  void computeBlockResidual(NodalKernel & kernel, NodalBlock & block);
+
   AuxiliarySystem & _aux_sys;
 
   const MooseObjectWarehouse<NodalKernel> & _nodal_kernels;
 
   /// Number of contributions cached up
   unsigned int _num_cached;
+
+  /// The nodes not computed yet by the kernels computing block residuals
+  std::map<NodalKernel *, NodalBlock> _blocks;
+
+  ///@{ Buffers for the values and residuals of a block
+  std::vector<Real> _block_u;
+  std::vector<Real> _block_u_dot;
+  std::vector<Real> _block_residual;
+  ///@}
 };
 
 #endif // COMPUTENODALKERNELSTHREAD_H
@@ -0,0 +1,75 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTENODEFACECONSTRAINTSTHREAD_H
+#define COMPUTENODEFACECONSTRAINTSTHREAD_H
+
+#include "ThreadedNodeLoop.h"
+
+// Forward declarations
+class NonlinearSystemBase;
+class ConstraintWarehouse;
+class PenetrationLocator;
+
+/**
+ * Computes the NodeFaceConstraint residuals (or Jacobians) for the local slave nodes of a
+ * PenetrationLocator.  The contributions are cached in the Assembly of each thread, the caller
+ * has to add them to the residual (or Jacobian) of every thread afterwards.
+ */
+class ComputeNodeFaceConstraintsThread
+    : public ThreadedNodeLoop<NodeIdRange, NodeIdRange::const_iterator>
+{
+public:
+  /**
+   * @param jacobian The Jacobian to compute, or NULL for computing the residual
+   */
+  ComputeNodeFaceConstraintsThread(FEProblemBase & fe_problem,
+                                   ConstraintWarehouse & constraints,
+                                   PenetrationLocator & pen_loc,
+                                   bool displaced,
+                                   NumericVector<Number> * residual,
+                                   SparseMatrix<Number> * jacobian);
+
+  // Splitting Constructor
+  ComputeNodeFaceConstraintsThread(ComputeNodeFaceConstraintsThread & x, Threads::split split);
+
+  virtual void onNode(NodeIdRange::const_iterator & node_it) override;
+
+  void join(const ComputeNodeFaceConstraintsThread & y);
+
+  /// Whether any constraint was applied on the nodes of this thread
+  bool _constraints_applied;
+
+  /// Whether any constraint inserted values into the residual directly
+  bool _residual_has_inserted_values;
+
+  /// Jacobian rows that have to be zeroed for the constraints overwriting the slave Jacobian
+  std::vector<numeric_index_type> _zero_rows;
+
+protected:
+  /// Compute the residual contributions of the constraints at the current node
+  void computeResidual();
+
+  /// Compute the Jacobian contributions of the constraints at the current node
+  void computeJacobian();
+
+  NonlinearSystemBase & _nl;
+  ConstraintWarehouse & _constraints;
+  PenetrationLocator & _pen_loc;
+  const bool _displaced;
+  NumericVector<Number> * _residual;
+  SparseMatrix<Number> * _jacobian;
+};
+
+#endif // COMPUTENODEFACECONSTRAINTSTHREAD_H
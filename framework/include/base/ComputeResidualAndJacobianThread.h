@@ -0,0 +1,48 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTERESIDUALANDJACOBIANTHREAD_H
+#define COMPUTERESIDUALANDJACOBIANTHREAD_H
+
+#include "ComputeJacobianThread.h"
+
+/**
+ * Computes the element residual and Jacobian contributions of all the Kernels, IntegratedBCs,
+ * DGKernels and InterfaceKernels in a single loop, so that the materials are evaluated once.
+ */
+class ComputeResidualAndJacobianThread : public ComputeJacobianThread
+{
+public:
+  ComputeResidualAndJacobianThread(FEProblemBase & fe_problem, SparseMatrix<Number> & jacobian);
+
+  // Splitting Constructor
+  ComputeResidualAndJacobianThread(ComputeResidualAndJacobianThread & x, Threads::split split);
+
+  virtual ~ComputeResidualAndJacobianThread();
+
+  virtual void postElement(const Elem * elem) override;
+
+  void join(const ComputeJacobianThread & /*y*/) {}
+
+protected:
+  virtual void computeJacobian() override;
+  virtual void computeFaceJacobian(BoundaryID bnd_id) override;
+  virtual void computeInternalFaceJacobian(const Elem * neighbor) override;
+  virtual void computeInternalInterFaceJacobian(BoundaryID bnd_id) override;
+
+  /// The number of elements whose residual is cached on this thread
+  unsigned int _num_residuals_cached;
+};
+
+#endif // COMPUTERESIDUALANDJACOBIANTHREAD_H
@@ -48,6 +48,8 @@ public:
   virtual void onElement(const Elem * elem) override;
   virtual void onBoundary(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void onInternalSide(const Elem * elem, unsigned int side) override;
+  virtual bool needInternalSides(SubdomainID subdomain) override;
+  virtual bool needInterfaces() override;
   virtual void post() override;
   virtual void subdomainChanged() override;
 
@@ -62,6 +64,12 @@ protected:
   const MooseObjectWarehouse<SideUserObject> & _side_user_objects;
   const MooseObjectWarehouse<InternalSideUserObject> & _internal_side_user_objects;
   ///@}
+
+  /// Whether any ElementUserObject is active on the current subdomain
+  bool _has_elemental_objects;
+
+  /// Whether the ElementUserObjects on the current subdomain need volume material properties
+  bool _need_element_materials;
 };
 
 #endif // COMPUTEUSEROBJECTSTHREAD_H
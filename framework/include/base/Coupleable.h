@@ -16,6 +16,7 @@
 #define COUPLEABLE_H
 
 // MOOSE includes
+#include "ADReal.h"
 #include "MooseVariableBase.h"
 
 // Forward declarations
@@ -144,6 +145,28 @@ protected:
   virtual const VariableGradient & coupledGradient(const std::string & var_name,
                                                    unsigned int comp = 0);
 
+  /**
+   * Returns the value of a coupled nonlinear variable carrying its derivatives with respect to
+   * the degrees of freedom of the variable, for objects that compute exact Jacobians with
+   * forward mode automatic differentiation (see ADReal.h). Only available for implicit element
+   * objects and coupled variables without default values.
+   * @param var_name Name of coupled variable
+   * @param comp Component number for vector of coupled variables
+   * @return Reference to an ADVariableValue for the coupled variable
+   */
+  virtual const ADVariableValue & adCoupledValue(const std::string & var_name,
+                                                 unsigned int comp = 0);
+
+  /**
+   * Returns the gradient of a coupled nonlinear variable carrying its derivatives, see
+   * adCoupledValue()
+   * @param var_name Name of coupled variable
+   * @param comp Component number for vector of coupled variables
+   * @return Reference to an ADVariableGradient for the coupled variable
+   */
+  virtual const ADVariableGradient & adCoupledGradient(const std::string & var_name,
+                                                       unsigned int comp = 0);
+
   /**
    * Returns an old gradient from previous time step of a coupled variable
    * @param var_name Name of coupled variable
@@ -327,6 +350,12 @@ protected:
    */
   void validateExecutionerType(const std::string & name) const;
 
+  /**
+   * Checks that values carrying derivatives can be provided for a coupled variable
+   * @param var_name the name of the variable
+   */
+  void checkADCoupling(const std::string & var_name);
+
   /// Whether or not this object is a "neighbor" object: ie all of it's coupled values should be neighbor values
   bool _coupleable_neighbor;
 
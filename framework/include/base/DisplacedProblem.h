@@ -17,6 +17,7 @@
 
 #include "SubProblem.h"
 #include "DisplacedSystem.h"
+#include "FEProblemBase.h"
 #include "GeometricSearchData.h"
 
 // libMesh
@@ -29,7 +30,6 @@ class AssemblyData;
 class DisplacedProblem;
 class MooseMesh;
 class Assembly;
-class FEProblemBase;
 
 // libMesh forward declarations
 namespace libMesh
@@ -93,6 +93,7 @@ public:
   /**
    * Copy the solutions on the undisplaced systems to the displaced systems and
    * reinitialize the geometry search data and Dirac kernel information due to mesh displacement.
+   * Nothing is done if the mesh was already updated at the current solutions.
    */
   virtual void updateMesh();
 
@@ -280,6 +281,34 @@ protected:
 
   GeometricSearchData _geometric_search_data;
 
+  /**
+   * Whether the displaced mesh was already updated at these solutions, in which case
+   * updateMesh() has nothing to do.  Otherwise the states are remembered for the next call.
+   */
+  bool upToDate(const NumericVector<Number> & soln, const NumericVector<Number> & aux_soln);
+
+  /// Forget the solutions of the last update, the next updateMesh() call updates the mesh
+  void invalidateUpdate() { _has_update_keys = false; }
+
+  ///@{
+  /// The states of the solutions at the last mesh update, valid if _has_update_keys
+  FEProblemBase::SolutionStateKey _nl_update_key;
+  FEProblemBase::SolutionStateKey _aux_update_key;
+  bool _has_update_keys;
+  ///@}
+
+  ///@{
+  /**
+   * The ghosted copies of the solutions used to move the nodes and their send lists (the
+   * displacement DOFs of all nodes), built once and reused until the mesh changes
+   */
+  std::shared_ptr<NumericVector<Number>> _nl_ghosted_soln;
+  std::shared_ptr<NumericVector<Number>> _aux_ghosted_soln;
+  std::vector<dof_id_type> _nl_send_list;
+  std::vector<dof_id_type> _aux_send_list;
+  bool _have_ghosted_solns;
+  ///@}
+
 private:
   friend class UpdateDisplacedMeshThread;
   friend class Restartable;
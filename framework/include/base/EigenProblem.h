@@ -44,6 +44,12 @@ public:
   virtual bool isGeneralizedEigenvalueProblem() { return _generalized_eigenvalue_problem; }
   virtual bool isNonlinearEigenvalueSolver();
 
+  /**
+   * Whether the eigen solver starts from the current solution: the initial condition on the
+   * first solve, then the first eigenvector of the previous solve
+   */
+  bool warmStart() const { return _warm_start; }
+
   // silences warning in debug mode about the other computeJacobian signature being hidden
   using FEProblemBase::computeJacobian;
 
@@ -58,6 +64,9 @@ protected:
   unsigned int _n_eigen_pairs_required;
   bool _generalized_eigenvalue_problem;
   NonlinearEigenSystem * _nl_eigen;
+
+  /// Whether the current solution is the initial space of the eigen solver
+  const bool _warm_start;
 };
 
 #endif /* EIGENPROBLEM_H */
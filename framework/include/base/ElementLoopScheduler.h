@@ -0,0 +1,152 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ELEMENTLOOPSCHEDULER_H
+#define ELEMENTLOOPSCHEDULER_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/elem_range.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * Runs a threaded element loop over chunks of the element range whose sizes are weighted by the
+ * measured cost of the elements of each subdomain.  The threads take chunks from a shared
+ * counter until none is left, so a thread that finishes early keeps pulling work instead of
+ * idling while another one is in an expensive block.
+ *
+ * Chunks never straddle a subdomain boundary, which keeps subdomainChanged() calls rare and lets
+ * the time of each chunk update the per-element cost estimate of its subdomain.
+ */
+class ElementLoopScheduler
+{
+public:
+  /// The element loops that keep separate cost estimates
+  enum Loop
+  {
+    RESIDUAL,
+    JACOBIAN,
+    MATERIAL,
+    N_LOOPS
+  };
+
+  ElementLoopScheduler();
+
+  /// Enables the scheduler; when disabled reduce() is a plain Threads::parallel_reduce()
+  void enable(bool enabled) { _enabled = enabled; }
+  bool enabled() const { return _enabled; }
+
+  /// Discards the chunks and cost estimates, e.g. when the mesh changed
+  void reset();
+
+  /**
+   * Execute \p body over \p range, see Threads::parallel_reduce()
+   */
+  template <typename Body>
+  void reduce(const ConstElemRange & range, Body & body);
+
+protected:
+  /// Rebuild the chunks for \p range from the current cost estimates
+  void buildChunks(const ConstElemRange & range);
+
+  /// Update the cost estimates from the measured chunk times
+  void updateCosts();
+
+  /**
+   * The body executed by each thread, which pulls chunks until all are taken
+   */
+  template <typename Body>
+  class ChunkLoop
+  {
+  public:
+    ChunkLoop(ElementLoopScheduler & scheduler, Body & body) : _scheduler(scheduler), _body(body) {}
+
+    ChunkLoop(ChunkLoop & x, Threads::split split)
+      : _scheduler(x._scheduler), _split_body(new Body(x._body, split)), _body(*_split_body)
+    {
+    }
+
+    void operator()(const Threads::BlockedRange<unsigned int> & /*range*/)
+    {
+      std::size_t chunk;
+      while ((chunk = _scheduler._next_chunk++) < _scheduler._chunks.size())
+      {
+        const auto start = std::chrono::steady_clock::now();
+        _body(_scheduler._chunks[chunk]);
+        _scheduler._chunk_times[chunk] =
+            std::chrono::duration<Real>(std::chrono::steady_clock::now() - start).count();
+      }
+    }
+
+    void join(const ChunkLoop & y) { _body.join(y._body); }
+
+  protected:
+    ElementLoopScheduler & _scheduler;
+    std::unique_ptr<Body> _split_body;
+    Body & _body;
+  };
+
+  bool _enabled;
+
+  /// The range the chunks were built for
+  const ConstElemRange * _range;
+  std::size_t _range_size;
+
+  /// Chunks of the current range
+  std::vector<ConstElemRange> _chunks;
+
+  /// Time spent on each chunk during the last loop
+  std::vector<Real> _chunk_times;
+
+  /// Index of the next chunk to be taken by a thread
+  std::atomic<std::size_t> _next_chunk;
+
+  /// Estimated cost (s) of one element of each subdomain
+  std::map<SubdomainID, Real> _subdomain_costs;
+
+  /// The number of chunks per thread
+  static const unsigned int _chunks_per_thread = 8;
+};
+
+template <typename Body>
+void
+ElementLoopScheduler::reduce(const ConstElemRange & range, Body & body)
+{
+  if (!_enabled || libMesh::n_threads() == 1 || range.empty())
+  {
+    Threads::parallel_reduce(range, body);
+    return;
+  }
+
+  if (&range != _range || range.size() != _range_size)
+    _subdomain_costs.clear();
+  buildChunks(range);
+
+  _next_chunk = 0;
+  ChunkLoop<Body> loop(*this, body);
+  Threads::parallel_reduce(Threads::BlockedRange<unsigned int>(0, libMesh::n_threads(), 1), loop);
+
+  updateCosts();
+}
+
+#endif // ELEMENTLOOPSCHEDULER_H
@@ -32,12 +32,15 @@
 #include "MooseVariableBase.h"
 #include "MultiAppTransfer.h"
 #include "Postprocessor.h"
+#include "ElementLoopScheduler.h"
+#include "EvaluationCounters.h"
 
 // libMesh includes
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/equation_systems.h"
 
 #include <unordered_map>
+#include <tuple>
 
 // Forward declarations
 class AuxiliarySystem;
@@ -54,6 +57,7 @@ class MaterialPropertyStorage;
 class MaterialData;
 class MooseEnum;
 class Resurrector;
+class MemoryReport;
 class Assembly;
 class JacobianBlock;
 class Control;
@@ -169,6 +173,13 @@ public:
   /// Set custom coupling matrix for variables requiring nonlocal contribution
   void setNonlocalCouplingMatrix();
 
+  /**
+   * Removes the couplings between scalar and field variables that no kernel or integrated BC
+   * computes a Jacobian block for, so that the scalar rows and columns of the Jacobian are not
+   * dense
+   */
+  void pruneScalarCoupling();
+
   bool areCoupled(unsigned int ivar, unsigned int jvar);
 
   std::vector<std::pair<MooseVariable *, MooseVariable *>> & couplingEntries(THREAD_ID tid);
@@ -398,6 +409,21 @@ public:
    */
   virtual void useFECache(bool fe_cache) override;
 
+  /**
+   * Whether or not the assemblies of this problem keep separate volume FE objects for each
+   * element type, see Assembly::useFEPool().
+   */
+  void useFEPool(bool fe_pool);
+
+  /**
+   * Limit the FE shape function cache.
+   *
+   * @param memory_limit Memory budget of the cache in megabytes, split evenly between the threads
+   * (0 for no limit)
+   * @param blocks The subdomains to cache the shape functions on, empty for all subdomains
+   */
+  void setFECacheLimits(Real memory_limit, const std::vector<SubdomainName> & blocks);
+
   virtual void init() override;
   virtual void solve() override;
 
@@ -626,12 +652,35 @@ public:
    */
   virtual void prepareMaterials(SubdomainID blk_id, THREAD_ID tid);
 
+  /**
+   * Returns the materials out of \p materials that compute a property consumed by the objects of
+   * the current loop (see MaterialWarehouse::consumedObjects), or all of them when materials are
+   * not pruned or the consumers are unknown.
+   */
+  const std::vector<std::shared_ptr<Material>> &
+  consumedMaterials(const std::vector<std::shared_ptr<Material>> & materials, THREAD_ID tid);
+
   virtual void reinitMaterials(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
   virtual void reinitMaterialsFace(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
   virtual void
   reinitMaterialsNeighbor(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
   virtual void
   reinitMaterialsBoundary(BoundaryID boundary_id, THREAD_ID tid, bool swap_stateful = true);
+
+  /**
+   * Reinit the face and boundary materials of a boundary side like reinitMaterialsFace() and
+   * reinitMaterialsBoundary(), except for the materials with "compute_on_demand" that no other
+   * material of the side depends on. These are left to computeMaterialsOnDemand().
+   */
+  virtual void
+  reinitMaterialsFaceOnDemand(SubdomainID blk_id, BoundaryID boundary_id, THREAD_ID tid);
+
+  /**
+   * Compute the materials deferred by reinitMaterialsFaceOnDemand() on the current side that
+   * supply one of \p mat_prop_ids, directly or through another deferred material. Each material
+   * is computed at most once per side.
+   */
+  void computeMaterialsOnDemand(const std::set<unsigned int> & mat_prop_ids, THREAD_ID tid);
   /*
    * Swap back underlying data storing stateful material properties
    */
@@ -721,6 +770,11 @@ public:
    */
   PostprocessorValue & getPostprocessorValueOlder(const std::string & name);
 
+  /**
+   * Return the storage of all the post-processor values.
+   */
+  const PostprocessorData & getPostprocessorData() const { return _pps_data; }
+
   /**
    * Returns whether or not the current simulation has any multiapps
    */
@@ -769,6 +823,14 @@ public:
     return _vpps_data.hasVectors(vpp_name);
   }
 
+  /**
+   * Whether every processor only holds its own slice of the vectors of the VectorPostprocessor
+   */
+  bool vectorPostprocessorIsDistributed(const std::string & vpp_name)
+  {
+    return _vpps_data.isDistributed(vpp_name);
+  }
+
   /**
    * Get the vectors for a specific VectorPostprocessor.
    * @param vpp_name The name of the VectorPostprocessor
@@ -889,12 +951,27 @@ public:
   virtual void computeResidualType(const NumericVector<Number> & soln,
                                    NumericVector<Number> & residual,
                                    Moose::KernelType type = Moose::KT_ALL);
+  /**
+   * Computes the residual of the nonlinear residual objects only, using the auxiliary
+   * variables, user objects and controls from the last full residual evaluation.  This is used
+   * for the matrix-free Jacobian action of JFNK and PJFNK when kernel_jacobian_action is set.
+   */
+  virtual void computeJacobianActionResidual(const NumericVector<Number> & soln,
+                                             NumericVector<Number> & residual);
   virtual void computeJacobian(NonlinearImplicitSystem & sys,
                                const NumericVector<Number> & soln,
                                SparseMatrix<Number> & jacobian);
   virtual void computeJacobian(const NumericVector<Number> & soln,
                                SparseMatrix<Number> & jacobian,
                                Moose::KernelType kernel_type = Moose::KT_ALL);
+
+  /**
+   * Form the residual and the Jacobian at \p soln, the element contributions of both in a single
+   * element loop
+   */
+  void computeResidualAndJacobian(const NumericVector<Number> & soln,
+                                  NumericVector<Number> & residual,
+                                  SparseMatrix<Number> & jacobian);
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller
    * preconditioning matrices.
@@ -952,6 +1029,13 @@ public:
                              NumericVector<Number> & upper);
   virtual void computeNearNullSpace(NonlinearImplicitSystem & sys,
                                     std::vector<NumericVector<Number> *> & sp);
+
+  /**
+   * Build the rigid body modes of the given displacement variables and hand them to the solver
+   * as the near nullspace whenever no NearNullSpace vectors were requested explicitly.
+   * @param disp_vars Nonlinear variable numbers of the displacement components, ordered x, y, z.
+   */
+  void setRigidBodyModeVariables(const std::vector<unsigned int> & disp_vars);
   virtual void computeNullSpace(NonlinearImplicitSystem & sys,
                                 std::vector<NumericVector<Number> *> & sp);
   virtual void computeTransposeNullSpace(NonlinearImplicitSystem & sys,
@@ -1033,6 +1117,12 @@ public:
    */
   void setRestartFile(const std::string & file_name);
 
+  /**
+   * Restart from the shared memory snapshot written by a SharedMemorySnapshot output
+   * @param name The name of the snapshot
+   */
+  void setRestartSnapshot(const std::string & name);
+
   ///@{
   /**
    * Return a reference to the material property storage
@@ -1099,6 +1189,71 @@ public:
 
   virtual void meshChanged() override;
 
+  /**
+   * Enables or disables accumulating the time spent evaluating the residual on each
+   * local element. The accumulated times are used as element weights by
+   * repartitionByElementCost()
+   */
+  void collectElementCosts(bool collect);
+  bool collectingElementCosts() const { return _collect_element_costs; }
+
+  /// Adds cost (s) to the accumulated cost of the element with id elem_id
+  void addElementCost(dof_id_type elem_id, Real cost, THREAD_ID tid)
+  {
+    _element_costs[tid][elem_id] += cost;
+  }
+
+  /// Discards the accumulated element costs
+  void clearElementCosts();
+
+  /**
+   * Ratio of the largest accumulated element cost on any processor to the mean over
+   * all processors
+   */
+  Real elementCostImbalance();
+
+  /**
+   * Repartitions a replicated mesh with METIS, using the accumulated element costs as
+   * element weights, and then clears the costs
+   */
+  void repartitionByElementCost();
+
+  /**
+   * Add the estimated memory of the mesh, the systems, the stateful material properties, the
+   * geometric search, the assembly and the restartable data to \p report
+   */
+  void memoryReport(MemoryReport & report);
+
+  /// Identifies a solution vector state: the vector, its modification counter, the time and step
+  typedef std::tuple<const void *, long long, Real, int> SolutionStateKey;
+
+  /**
+   * Build the key of the state of a solution vector, false if it can not be identified
+   * (only PETSc vectors carry a modification counter).
+   */
+  bool solutionStateKey(const NumericVector<Number> & soln, SolutionStateKey & key) const;
+
+  /// The counts of the material, auxiliary kernel, user object, ... evaluations of this problem
+  EvaluationCounters & evaluationCounters() { return _evaluation_counters; }
+
+  /**
+   * Whether any object uses the displaced mesh, the displaced mesh is only updated at every
+   * residual and Jacobian evaluation if one does
+   */
+  bool haveDisplacedObjects() const { return _have_displaced_objects; }
+
+  /**
+   * Whether the element Jacobians are assembled color by color without locks, see
+   * MooseMesh::getActiveLocalElementColorRanges()
+   */
+  bool coloredJacobianAssembly();
+
+  /// The scheduler of one of the threaded element loops
+  ElementLoopScheduler & elementLoopScheduler(ElementLoopScheduler::Loop loop)
+  {
+    return _element_loop_schedulers[loop];
+  }
+
   /**
    * Register an object that derives from MeshChangedInterface
    * to be notified when the mesh changes.
@@ -1301,6 +1456,9 @@ protected:
   VectorPostprocessorData & getVectorPostprocessorData();
   ///@}
 
+  /// Fill the RigidBodyMode vectors from the coordinates of the local nodes
+  void computeRigidBodyModes();
+
   MooseMesh & _mesh;
   EquationSystems _eq;
   bool _initialized;
@@ -1325,6 +1483,9 @@ protected:
   // Dimension of the subspace spanned by the vectors with a given prefix
   std::map<std::string, unsigned int> _subspace_dim;
 
+  /// Displacement variables whose rigid body modes span the automatic near nullspace
+  std::vector<unsigned int> _rigid_body_mode_vars;
+
   std::vector<Assembly *> _assembly;
 
   /// functions
@@ -1470,6 +1631,9 @@ protected:
   /// Object responsible for restart (read/write)
   std::unique_ptr<Resurrector> _resurrector;
 
+  /// Name of the shared memory snapshot to restart from (empty when restarting from a file)
+  std::string _restart_snapshot;
+
   /// true if the Jacobian is constant
   bool _const_jacobian;
 
@@ -1505,6 +1669,42 @@ protected:
   /// Indicates whether or not this executioner has a time integrator (during setup)
   bool _has_time_integrator;
 
+  /// Whether the residual evaluation time of each element is being accumulated
+  bool _collect_element_costs;
+
+  /// Accumulated residual evaluation time of the local elements, for each thread
+  std::vector<std::unordered_map<dof_id_type, Real>> _element_costs;
+
+  /// Cost weighted schedulers of the residual, Jacobian and material element loops
+  ElementLoopScheduler _element_loop_schedulers[ElementLoopScheduler::N_LOOPS];
+
+  /// The number of evaluations of the materials, auxiliary kernels, user objects, ...
+  EvaluationCounters _evaluation_counters;
+
+  /// Whether any object was built on the displaced problem
+  bool _have_displaced_objects;
+
+  /// Whether materials computing no property consumed on the current loop are skipped
+  const bool _prune_materials;
+
+  /// The material properties consumed by the objects of the current loop, for each thread
+  std::vector<std::set<unsigned int>> _consumed_mat_props;
+
+  /// Computes \p materials on the current side, deferring the on demand ones if requested
+  void reinitBoundaryMaterialData(const std::vector<std::shared_ptr<Material>> & materials,
+                                  THREAD_ID tid);
+
+  /// Whether the on demand materials of the current side are being deferred, for each thread
+  std::vector<unsigned char> _defer_on_demand_materials;
+
+  /// The deferred materials of the current side and whether they were computed, for each thread
+  std::vector<std::vector<std::pair<std::shared_ptr<Material>, bool>>> _on_demand_materials;
+
+  /// The consumed subsets of the active material lists, for each thread
+  std::vector<std::unordered_map<const std::vector<std::shared_ptr<Material>> *,
+                                 std::vector<std::shared_ptr<Material>>>>
+      _consumed_materials;
+
   /// Whether or not an exception has occurred
   bool _has_exception;
 
@@ -1535,6 +1735,54 @@ private:
   /// At or beyond initialSteup stage
   bool _started_initial_setup;
 
+  /// Whether the JFNK residual after a Jacobian reuses the residual computed at the same solution
+  const bool _reuse_jfnk_residual;
+
+  /// The solution state the last full residual was computed at
+  SolutionStateKey _cached_residual_key;
+
+  /// Whether _cached_residual holds the residual at _cached_residual_key
+  bool _has_cached_residual;
+
+  /// Copy of the last full residual, only allocated with "reuse_jfnk_residual"
+  NumericVector<Number> * _cached_residual;
+
+  /**
+   * Execute everything that comes before the residual assembly at \p soln
+   * @return false if an exception was raised while computing the auxiliary variables
+   */
+  bool prepareResidualEvaluation(const NumericVector<Number> & soln);
+
+  /// Execute everything that comes before the Jacobian assembly at the current solution
+  void prepareJacobianEvaluation();
+
+  /// Whether the Newton residual evaluations also form the Jacobian
+  const bool _residual_and_jacobian_together;
+
+  /// The solution state the Jacobian formed together with the last residual belongs to
+  SolutionStateKey _combined_jacobian_key;
+
+  /// Whether the system matrix holds the Jacobian at _combined_jacobian_key
+  bool _has_combined_jacobian;
+
+  /// Errors if the problem can not be repartitioned by repartitionByElementCost()
+  void checkRepartitionByElementCost();
+
+  /**
+   * Split the processors among the groups of MultiApps that are not coupled through Transfers,
+   * so that these groups run concurrently.
+   */
+  void computeMultiAppProcessors();
+
+  /// Whether or not to run uncoupled MultiApps on separate processors
+  const bool _concurrent_multi_apps;
+
+  /// Whether to assemble the element Jacobians color by color
+  const bool _colored_jacobian_assembly;
+
+  /// The first processor and the number of processors of each MultiApp ("concurrent_multiapps")
+  std::map<std::string, std::pair<unsigned int, unsigned int>> _multi_app_processors;
+
   friend class AuxiliarySystem;
   friend class NonlinearSystemBase;
   friend class MooseEigenSystem;
@@ -1583,6 +1831,40 @@ FEProblemBase::finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse)
         objects[i]->threadJoin(*(other_objects[i]));
     }
 
+    // Reduce the deferred values of all of them at once
+    std::vector<Real> sums, maxs, mins;
+    for (const auto & object : objects)
+    {
+      for (const auto & value : object->deferredSums())
+        sums.push_back(*value);
+      for (const auto & value : object->deferredCountSums())
+        sums.push_back(*value);
+      for (const auto & value : object->deferredMaxs())
+        maxs.push_back(*value);
+      for (const auto & value : object->deferredMins())
+        mins.push_back(*value);
+    }
+
+    if (!sums.empty())
+      _communicator.sum(sums);
+    if (!maxs.empty())
+      _communicator.max(maxs);
+    if (!mins.empty())
+      _communicator.min(mins);
+
+    unsigned int i_sum = 0, i_max = 0, i_min = 0;
+    for (const auto & object : objects)
+    {
+      for (const auto & value : object->deferredSums())
+        *value = sums[i_sum++];
+      for (const auto & value : object->deferredCountSums())
+        *value = static_cast<unsigned int>(sums[i_sum++]);
+      for (const auto & value : object->deferredMaxs())
+        *value = maxs[i_max++];
+      for (const auto & value : object->deferredMins())
+        *value = mins[i_min++];
+    }
+
     // Finalize them and save off PP values
     for (auto & object : objects)
     {
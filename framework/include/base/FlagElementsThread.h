@@ -28,7 +28,7 @@ class FlagElementsThread : public ThreadedElementLoop<ConstElemRange>
 {
 public:
   FlagElementsThread(FEProblemBase & fe_problem,
-                     std::vector<Number> & serialized_solution,
+                     std::vector<Number> & marker_values,
                      unsigned int max_h_level,
                      const std::string & marker_name);
 
@@ -36,6 +36,8 @@ public:
   FlagElementsThread(FlagElementsThread & x, Threads::split split);
 
   virtual void onElement(const Elem * elem) override;
+  virtual bool needInternalSides(SubdomainID /*subdomain*/) override { return false; }
+  virtual bool needInterfaces() override { return false; }
 
   void join(const FlagElementsThread & /*y*/);
 
@@ -47,7 +49,8 @@ protected:
   Adaptivity & _adaptivity;
   MooseVariable & _field_var;
   unsigned int _field_var_number;
-  std::vector<Number> & _serialized_solution;
+  /// The marker value of every active element, indexed by element id
+  std::vector<Number> & _marker_values;
   unsigned int _max_h_level;
 };
 
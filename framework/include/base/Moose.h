@@ -19,6 +19,7 @@
 #include "libmesh/perf_log.h"
 #include "libmesh/libmesh_common.h"
 #include "XTermConstants.h"
+#include "PerfGraph.h"
 
 #include <string>
 
@@ -58,6 +59,8 @@ class Factory;
 // forward declarations
 class Syntax;
 class FEProblemBase;
+class ObjectTiming;
+class HardwareCounters;
 
 namespace Moose
 {
@@ -72,11 +75,31 @@ extern PerfLog perf_log;
  * PerfLog to be used during setup.  This log will get printed just before the first solve. */
 extern PerfLog setup_perf_log;
 
+/**
+ * Graph of the timed sections of the framework, see PerfGuard.
+ */
+extern PerfGraph perf_graph;
+
+/**
+ * Time spent in the hot methods of each object, see ObjectTimer.
+ */
+extern ObjectTiming object_timing;
+
+/**
+ * Hardware counters sampled per threaded element loop and subdomain, see HardwareCounterSample.
+ */
+extern HardwareCounters hardware_counters;
+
 /**
  * Variable indicating whether we will enable FPE trapping for this run.
  */
 extern bool _trap_fpe;
 
+/**
+ * Variable indicating whether the threads of the element and node loops are pinned to cores.
+ */
+extern bool _pin_threads;
+
 /**
  * Variable to toggle any warning into an error (includes deprecated code warnings)
  */
@@ -135,6 +158,12 @@ MPI_Comm swapLibMeshComm(MPI_Comm new_comm);
 
 void enableFPE(bool on = true);
 
+/**
+ * Pin the calling thread to the core matching \p tid among the cores the process was allowed to
+ * run on at startup.  Does nothing unless _pin_threads is set.
+ */
+void pinThread(unsigned int tid);
+
 // MOOSE Requires PETSc to run, this CPP check will cause a compile error if PETSc is not found
 #ifndef LIBMESH_HAVE_PETSC
 #error PETSc has not been detected, please ensure your environment is set up properly then rerun the libmesh build script and try to compile MOOSE again.
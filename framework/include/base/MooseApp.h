@@ -42,6 +42,7 @@ class MeshModifier;
 class InputParameterWarehouse;
 class SystemInfo;
 class CommandLine;
+struct SharedMeshData;
 
 template <>
 InputParameters validParams<MooseApp>();
@@ -425,6 +426,41 @@ public:
    */
   void restore(std::shared_ptr<Backup> backup, bool for_restart = false);
 
+  /**
+   * Set the data shared with the sibling sub-apps on this processor that are built from the same
+   * input file, see the MultiApp 'share_mesh' parameter
+   */
+  void setSharedMeshData(std::shared_ptr<SharedMeshData> data) { _shared_mesh_data = data; }
+
+  /// The data shared with the sibling sub-apps built from the same input, or nullptr
+  SharedMeshData * sharedMeshData() const { return _shared_mesh_data.get(); }
+
+  /**
+   * Create an in-memory snapshot of the restartable data of the UserObjects, Postprocessors and
+   * VectorPostprocessors.  Nothing is serialized: the data is copied into the Backup.
+   */
+  std::shared_ptr<Backup> snapshot();
+
+  /**
+   * Restore a snapshot created by snapshot().  The values are swapped with the current ones, so
+   * the snapshot holds the discarded state afterwards.
+   */
+  void restoreSnapshot(Backup & snapshot);
+
+  /**
+   * Copy the complete state of the App (the system solution vectors and all of the restartable
+   * data) into a Backup without serializing it.  The copies already held by the Backup are
+   * reused, so refreshing the same Backup does not reallocate.  Restartable data that can not be
+   * copied is stored into streams held by the Backup.
+   */
+  void memoryBackup(Backup & backup);
+
+  /**
+   * Restore a Backup filled by memoryBackup().  The Backup is left untouched so it may be restored
+   * any number of times.
+   */
+  void memoryRestore(Backup & backup);
+
   /**
    * Returns a string to be printed at the beginning of a simulation
    */
@@ -681,6 +717,9 @@ private:
   /// Cache for a Backup to use for restart / recovery
   std::shared_ptr<Backup> _cached_backup;
 
+  /// Mesh data shared with the sibling sub-apps built from the same input
+  std::shared_ptr<SharedMeshData> _shared_mesh_data;
+
   // Allow FEProblemBase to set the recover/restart state, so make it a friend
   friend class FEProblemBase;
   friend class Restartable;
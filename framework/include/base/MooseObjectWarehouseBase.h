@@ -168,12 +168,33 @@ protected:
   /// Active block restricted objects (THREAD_ID on outer vector)
   std::vector<std::map<SubdomainID, std::vector<std::shared_ptr<T>>>> _active_block_objects;
 
+  /**
+   * Active block restricted objects indexed directly by SubdomainID (THREAD_ID on outer vector),
+   * nullptr for subdomains without an entry in _active_block_objects.  Left empty when the
+   * largest id exceeds _max_dense_block_id, in which case the map is searched instead.
+   */
+  std::vector<std::vector<const std::vector<std::shared_ptr<T>> *>> _active_block_table;
+
   // All boundary restricted objects (THREAD_ID on outer vector)
   std::vector<std::map<BoundaryID, std::vector<std::shared_ptr<T>>>> _all_boundary_objects;
 
   /// Active boundary restricted objects (THREAD_ID on outer vector)
   std::vector<std::map<BoundaryID, std::vector<std::shared_ptr<T>>>> _active_boundary_objects;
 
+  /// The largest SubdomainID stored in the dense _active_block_table
+  static const SubdomainID _max_dense_block_id = 4096;
+
+  /**
+   * Rebuild the dense table of active block restricted objects.
+   */
+  void updateActiveBlockTable(THREAD_ID tid);
+
+  /**
+   * Locate the active objects for a subdomain, nullptr if there is no entry for it.
+   */
+  const std::vector<std::shared_ptr<T>> * findActiveBlockObjects(SubdomainID id,
+                                                                 THREAD_ID tid) const;
+
   /**
    * Helper method for updating active vectors
    */
@@ -210,6 +231,7 @@ MooseObjectWarehouseBase<T>::MooseObjectWarehouseBase(bool threaded /*=true*/)
     _active_objects(_num_threads),
     _all_block_objects(_num_threads),
     _active_block_objects(_num_threads),
+    _active_block_table(_num_threads),
     _all_boundary_objects(_num_threads),
     _active_boundary_objects(_num_threads)
 {
@@ -262,6 +284,7 @@ MooseObjectWarehouseBase<T>::addObject(std::shared_ptr<T> object, THREAD_ID tid
       if (enabled)
         _active_block_objects[tid][*it].push_back(object);
     }
+    updateActiveBlockTable(tid);
   }
 }
 
@@ -351,10 +374,9 @@ const std::vector<std::shared_ptr<T>> &
 MooseObjectWarehouseBase<T>::getActiveBlockObjects(SubdomainID id, THREAD_ID tid /* = 0*/) const
 {
   checkThreadID(tid);
-  const auto iter = _active_block_objects[tid].find(id);
-  mooseAssert(iter != _active_block_objects[tid].end(),
-              "Unable to located active block objects for the given id: " << id << ".");
-  return iter->second;
+  const auto objects = findActiveBlockObjects(id, tid);
+  mooseAssert(objects, "Unable to located active block objects for the given id: " << id << ".");
+  return *objects;
 }
 
 template <typename T>
@@ -381,8 +403,7 @@ bool
 MooseObjectWarehouseBase<T>::hasActiveBlockObjects(SubdomainID id, THREAD_ID tid /* = 0*/) const
 {
   checkThreadID(tid);
-  const auto iter = _active_block_objects[tid].find(id);
-  return iter != _active_block_objects[tid].end();
+  return findActiveBlockObjects(id, tid) != nullptr;
 }
 
 template <typename T>
@@ -451,6 +472,37 @@ MooseObjectWarehouseBase<T>::updateActive(THREAD_ID tid /*= 0*/)
 
   for (const auto & object_pair : _all_boundary_objects[tid])
     updateActiveHelper(_active_boundary_objects[tid][object_pair.first], object_pair.second);
+
+  updateActiveBlockTable(tid);
+}
+
+template <typename T>
+void
+MooseObjectWarehouseBase<T>::updateActiveBlockTable(THREAD_ID tid)
+{
+  auto & table = _active_block_table[tid];
+  table.clear();
+
+  const auto & block_objects = _active_block_objects[tid];
+  if (block_objects.empty() || block_objects.rbegin()->first > _max_dense_block_id)
+    return;
+
+  // The map nodes are stable, so the table can point into them until the next update
+  table.resize(block_objects.rbegin()->first + 1, nullptr);
+  for (const auto & object_pair : block_objects)
+    table[object_pair.first] = &object_pair.second;
+}
+
+template <typename T>
+inline const std::vector<std::shared_ptr<T>> *
+MooseObjectWarehouseBase<T>::findActiveBlockObjects(SubdomainID id, THREAD_ID tid) const
+{
+  const auto & table = _active_block_table[tid];
+  if (!table.empty())
+    return id < table.size() ? table[id] : nullptr;
+
+  const auto iter = _active_block_objects[tid].find(id);
+  return iter != _active_block_objects[tid].end() ? &iter->second : nullptr;
 }
 
 template <typename T>
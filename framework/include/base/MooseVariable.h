@@ -15,6 +15,7 @@
 #ifndef MOOSEVARIABLE_H
 #define MOOSEVARIABLE_H
 
+#include "ADReal.h"
 #include "MooseTypes.h"
 #include "MooseVariableBase.h"
 
@@ -146,6 +147,27 @@ public:
     return _u_previous_nl;
   }
   const VariableGradient & gradSln() { return _grad_u; }
+
+  ///@{
+  /**
+   * Values and gradients at the quadrature points of the current element that carry their
+   * derivatives with respect to the degrees of freedom of this variable, see ADReal.h. The
+   * derivatives of auxiliary variables are zero.
+   */
+  const ADVariableValue & adSln()
+  {
+    _need_ad_u = true;
+    return _ad_u;
+  }
+  const ADVariableGradient & adGradSln()
+  {
+    _need_ad_grad_u = true;
+    return _ad_grad_u;
+  }
+  ///@}
+
+  /// The index of the derivative with respect to the first degree of freedom of this variable
+  unsigned int adOffset();
   const VariableGradient & gradSlnOld()
   {
     _need_grad_old = true;
@@ -312,6 +334,22 @@ public:
    * Compute values at interior quadrature points
    */
   void computeElemValues();
+  /**
+   * Compute the values carrying derivatives that were requested with adSln() and adGradSln(),
+   * after computeElemValues()
+   */
+  void computeADElemValues();
+  /**
+   * Whether nothing beyond the values, gradients and time derivatives of this variable is needed
+   * at the interior quadrature points, so it can be evaluated by computeElemValuesFused()
+   */
+  bool canFuseElemValues() const;
+  /**
+   * Compute values at interior quadrature points for several variables sharing an FE type in a
+   * single pass over the shape functions
+   * @param vars The variables, all of which must satisfy canFuseElemValues()
+   */
+  static void computeElemValuesFused(const std::vector<MooseVariable *> & vars);
   /**
    * Compute values at facial quadrature points
    */
@@ -371,6 +409,12 @@ public:
   void insert(NumericVector<Number> & residual);
   void add(NumericVector<Number> & residual);
 
+  /**
+   * Append the dof indices and the values that insert() would set to the given buffers, so they
+   * can be inserted into a vector later with a single call
+   */
+  void appendValues(std::vector<dof_id_type> & dof_indices, std::vector<Number> & values) const;
+
   /**
    * Get the value of this variable at given node
    */
@@ -482,6 +526,9 @@ protected:
   bool _need_nodal_u_previous_nl;
   bool _need_nodal_u_dot;
 
+  bool _need_ad_u;
+  bool _need_ad_grad_u;
+
   bool _need_nodal_u_neighbor;
   bool _need_nodal_u_old_neighbor;
   bool _need_nodal_u_older_neighbor;
@@ -524,6 +571,9 @@ protected:
   VariableSecond _second_u_older, _second_u_older_bak;
   VariableSecond _second_u_previous_nl;
 
+  ADVariableValue _ad_u;
+  ADVariableGradient _ad_grad_u;
+
   VariableValue _u_neighbor;
   VariableValue _u_old_neighbor;
   VariableValue _u_older_neighbor;
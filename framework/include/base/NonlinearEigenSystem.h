@@ -114,6 +114,7 @@ public:
   }
 
 protected:
+  EigenProblem & _eigen_problem;
   TransientEigenSystem & _transient_sys;
 
   std::vector<std::pair<Real, Real>> _eigen_values;
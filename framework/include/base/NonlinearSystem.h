@@ -44,6 +44,10 @@ public:
     return _transient_sys.get_current_nonlinear_iteration_number();
   }
 
+  /**
+   * Attaches the finite differenced Jacobian to the solver. The coloring is computed from the
+   * Jacobian sparsity on the first solve and reused until the mesh changes.
+   */
   virtual void setupFiniteDifferencedPreconditioner() override;
 
   /**
@@ -72,6 +76,9 @@ public:
   virtual TransientNonlinearImplicitSystem & sys() { return _transient_sys; }
 
 protected:
+  /// Destroys the cached finite difference coloring
+  void destroyFiniteDifferenceColoring();
+
   TransientNonlinearImplicitSystem & _transient_sys;
 };
 
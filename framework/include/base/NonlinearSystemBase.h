@@ -16,6 +16,8 @@
 #define NONLINEARSYSTEMBASE_H
 
 #include "SystemBase.h"
+#include "Assembly.h"
+#include "CSRMatrixCache.h"
 #include "KernelWarehouse.h"
 #include "ConstraintWarehouse.h"
 #include "MooseObjectWarehouse.h"
@@ -271,6 +273,15 @@ public:
   void computeJacobian(SparseMatrix<Number> & jacobian,
                        Moose::KernelType kernel_type = Moose::KT_ALL);
 
+  /**
+   * Computes the residual and the Jacobian together, the element contributions of both are
+   * formed in a single element loop.
+   * @param residual Residual is formed in here
+   * @param jacobian Jacobian is formed in here
+   */
+  void computeResidualAndJacobian(NumericVector<Number> & residual,
+                                  SparseMatrix<Number> & jacobian);
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller
    * preconditioning matrices.
@@ -429,6 +440,48 @@ public:
    */
   unsigned int nResidualEvaluations() { return _n_residual_evaluations; }
 
+  /**
+   * Return the total number of Jacobian evaluations done so far in this calculation
+   */
+  unsigned int nJacobianEvaluations() { return _n_jacobian_evaluations; }
+
+  /**
+   * Keep the dofs of the given variables at their current values in the following solves: their
+   * residual rows are zeroed and their Jacobian rows replaced by identity rows.
+   * @param vars Nonlinear variable numbers, an empty list releases all variables
+   */
+  void setFrozenVariables(const std::vector<unsigned int> & vars);
+
+  /**
+   * Collect the local dofs whose residual rows are currently set by nodal boundary conditions
+   * @param dofs The dof indices, returned sorted and without duplicates
+   */
+  void getNodalBCDofs(std::vector<dof_id_type> & dofs);
+
+  /**
+   * Reuse the Jacobian (and with it the preconditioner) across Newton iterations and solves
+   * for as long as the nonlinear residual keeps contracting.
+   * @param contraction Largest ratio of successive residual norms at which the Jacobian is kept
+   * @param max_lag Maximum number of Newton iterations performed with one Jacobian
+   */
+  void setAdaptiveJacobianLag(Real contraction, unsigned int max_lag);
+
+  /**
+   * Whether the adaptive Jacobian lag is active
+   */
+  bool adaptiveJacobianLag() const { return _adaptive_jacobian_lag; }
+
+  /**
+   * Whether the Jacobian has to be rebuilt before the first Newton iteration of the next solve
+   */
+  bool jacobianLagExpiredForSolve();
+
+  /**
+   * Record the residual norm of Newton iteration 'it' of the current solve.
+   * @return true if the Jacobian has to be rebuilt before the next Newton step
+   */
+  bool jacobianLagExpired(unsigned int it, Real fnorm);
+
   /**
    * Return the final nonlinear residual
    */
@@ -514,6 +567,41 @@ public:
    */
   bool hasDiagSaveIn() const { return _has_diag_save_in || _has_nodalbc_diag_save_in; }
 
+  /**
+   * Whether or not the current Jacobian evaluation reuses the element contributions of the
+   * Kernels with a constant Jacobian
+   */
+  bool useConstantJacobian() const { return _use_constant_jacobian; }
+
+  /**
+   * Whether or not the constant Jacobian contributions of all the local elements are stored
+   */
+  bool haveConstantJacobian() const { return _have_constant_jacobian; }
+
+  /**
+   * The stored constant Jacobian contributions of \p elem, only valid when
+   * haveConstantJacobian() is true
+   */
+  const std::vector<Assembly::SavedJacobianBlock> & constantJacobian(const Elem * elem) const;
+
+  /**
+   * Store the element Jacobian blocks currently in the Assembly of \p tid as the constant
+   * Jacobian contributions of \p elem
+   */
+  void cacheConstantJacobian(const Elem * elem, THREAD_ID tid);
+
+  /**
+   * Discard the stored constant Jacobian contributions, they are recomputed at the next Jacobian
+   * evaluation
+   */
+  void invalidateConstantJacobian();
+
+  /**
+   * Discard the stored sparsity pattern of the Jacobian, it is copied again after the next
+   * Jacobian evaluation
+   */
+  void clearJacobianSparsity() { _jacobian_csr.clear(); }
+
   virtual NumericVector<Number> & solution() override { return *_sys.solution; }
 
   virtual System & system() override { return _sys; }
@@ -553,6 +641,13 @@ protected:
 
   void computeJacobianInternal(SparseMatrix<Number> & jacobian, Moose::KernelType kernel_type);
 
+  /**
+   * Run the element loop of \p cj over \p elem_range, color by color when the problem uses
+   * colored Jacobian assembly (see FEProblemBase::coloredJacobianAssembly())
+   */
+  template <typename JacobianThread>
+  void computeElementJacobians(const ConstElemRange & elem_range, JacobianThread & cj);
+
   void computeDiracContributions(SparseMatrix<Number> * jacobian = NULL);
 
   void computeScalarKernelsJacobians(SparseMatrix<Number> & jacobian);
@@ -579,7 +674,7 @@ protected:
 
   /// Time integrator
   std::shared_ptr<TimeIntegrator> _time_integrator;
-  /// solution vector for u^dot
+  /// solution vector for u^dot, only allocated for transient problems
   NumericVector<Number> * _u_dot;
   /// \f$ {du^dot}\over{du} \f$
   Number _du_dot_du;
@@ -646,6 +741,10 @@ protected:
 #ifdef LIBMESH_HAVE_PETSC
   MatFDColoring _fdcoloring;
 #endif
+  /// Whether _fdcoloring holds a coloring that is reused by the following solves
+  bool _have_fdcoloring;
+  /// The mesh changed count at the time _fdcoloring was computed
+  unsigned int _fdcoloring_mesh_changed_count;
   /// Whether or not the system can be decomposed into splits
   bool _have_decomposition;
   /// Name of the top-level split of the decomposition
@@ -672,6 +771,12 @@ protected:
   /// true if DG is active (optimization reasons)
   bool _doing_dg;
 
+  /// Whether the element residual is formed by the Jacobian element loop
+  bool _residual_and_jacobian_together;
+
+  /// Whether the element residual contributions are already in the residual vectors
+  bool _element_residual_computed;
+
   /// vectors that will be zeroed before a residual computation
   std::vector<std::string> _vecs_to_zero_for_residual;
 
@@ -681,6 +786,21 @@ protected:
   /// Total number of residual evaluations that have been performed
   unsigned int _n_residual_evaluations;
 
+  /// Total number of Jacobian evaluations that have been performed
+  unsigned int _n_jacobian_evaluations;
+
+  /// Local dofs of the variables frozen by setFrozenVariables()
+  std::vector<numeric_index_type> _frozen_dofs;
+
+  ///@{
+  /// Adaptive Jacobian lag settings and the age of the current Jacobian
+  bool _adaptive_jacobian_lag;
+  Real _jacobian_lag_contraction;
+  unsigned int _max_jacobian_lag;
+  unsigned int _jacobian_lag_its;
+  Real _jacobian_lag_last_fnorm;
+  ///@}
+
   Real _final_residual;
 
   /// If predictor is active, this is non-NULL
@@ -702,6 +822,24 @@ protected:
   /// If there is a nodal BC having diag_save_in
   bool _has_nodalbc_diag_save_in;
 
+  /// If there is any Kernel with a constant Jacobian
+  bool _has_constant_jacobian_kernels;
+
+  /// True while a Jacobian evaluation uses the constant Jacobian contributions
+  bool _use_constant_jacobian;
+
+  /// True when _constant_jacobian holds the contributions of every local element
+  bool _have_constant_jacobian;
+
+  /// The time derivative coefficient the constant Jacobian contributions were computed with
+  Number _constant_jacobian_du_dot_du;
+
+  /// The element Jacobian contributions of the Kernels with a constant Jacobian
+  std::unordered_map<dof_id_type, std::vector<Assembly::SavedJacobianBlock>> _constant_jacobian;
+
+  /// The local sparsity pattern of the system matrix, used to add the element Jacobians by rows
+  CSRMatrixCache _jacobian_csr;
+
   void getNodeDofs(dof_id_type node_id, std::vector<dof_id_type> & dofs);
 
   std::vector<dof_id_type> _var_all_dof_indices;
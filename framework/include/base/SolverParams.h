@@ -25,6 +25,12 @@ public:
   Moose::SolveType _type;
   Moose::LineSearchType _line_search;
 
+  /// Whether or not the matrix-free Jacobian action only re-evaluates the residual objects
+  bool _kernel_jacobian_action;
+
+  /// Whether or not BoomerAMG is set up with coarsening and interpolation of low complexity
+  bool _low_memory_amg;
+
   // solver parameters for eigenvalue problems
   Moose::EigenSolveType _eigen_solve_type;
   Moose::EigenProblemType _eigen_problem_type;
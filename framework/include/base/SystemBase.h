@@ -31,6 +31,7 @@
 // Forward declarations
 class Factory;
 class MooseApp;
+class MemoryReport;
 class MooseVariable;
 class MooseMesh;
 class SubProblem;
@@ -451,6 +452,13 @@ public:
 
   virtual const std::string & name() { return system().name(); }
 
+  /**
+   * Add the estimated bytes held by the DOF map, the vectors and the matrices of this system to
+   * \p report.  The size of the system matrix is the memory PETSc allocated for it; matrices
+   * of other solver packages are not counted.
+   */
+  virtual void memoryFootprint(MemoryReport & report);
+
   /**
    * Adds a scalar variable
    * @param var_name The name of the variable
@@ -503,6 +511,15 @@ protected:
   Moose::VarKindType _var_kind;
 
   std::vector<VarCopyInfo> _var_to_copy;
+
+  /// Variables evaluated together by reinitElem(), grouped by FE type (one set for each thread)
+  std::vector<std::vector<std::vector<MooseVariable *>>> _elem_value_groups;
+
+private:
+  /**
+   * Evaluate a variable right away in reinitElem(), or add it to the group of its FE type
+   */
+  void groupElemValues(MooseVariable * var, std::vector<std::vector<MooseVariable *>> & groups);
 };
 
 #define PARALLEL_TRY
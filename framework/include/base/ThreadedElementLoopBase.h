@@ -19,6 +19,11 @@
 #include "MooseMesh.h"
 #include "MooseTypes.h"
 #include "MooseException.h"
+#include "HardwareCounters.h"
+
+#include "libmesh/boundary_info.h"
+
+#include <algorithm>
 
 /**
  * Base class for assembly-like calculations.
@@ -124,6 +129,19 @@ public:
    */
   virtual void neighborSubdomainChanged();
 
+  /**
+   * Whether preInternalSide(), onInternalSide() and postInternalSide() may do any work on the
+   * internal sides of the elements of \p subdomain. The sides of the other subdomains are
+   * skipped, unless they carry a boundary id and needInterfaces() is true.
+   */
+  virtual bool needInternalSides(SubdomainID /*subdomain*/) { return true; }
+
+  /**
+   * Whether onInterface() may do any work, in which case the internal sides carrying a boundary
+   * id are always visited
+   */
+  virtual bool needInterfaces() { return true; }
+
   /**
    * Called if a MooseException is caught anywhere during the computation.
    * The single input parameter taken is a MooseException object.
@@ -152,17 +170,21 @@ protected:
 
   /// The subdomain for the last neighbor
   SubdomainID _old_neighbor_subdomain;
+
+  /// Whether the internal sides of the current subdomain are visited, see needInternalSides()
+  bool _need_internal_sides;
 };
 
 template <typename RangeType>
-ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(MooseMesh & mesh) : _mesh(mesh)
+ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(MooseMesh & mesh)
+  : _mesh(mesh), _need_internal_sides(true)
 {
 }
 
 template <typename RangeType>
 ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(ThreadedElementLoopBase & x,
                                                             Threads::split /*split*/)
-  : _mesh(x._mesh)
+  : _mesh(x._mesh), _need_internal_sides(true)
 {
 }
 
@@ -179,31 +201,39 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
   {
     ParallelUniqueId puid;
     _tid = bypass_threading ? 0 : puid.id;
+    Moose::pinThread(_tid);
 
     pre();
 
+    // Counts the events of the elements of each subdomain, including subdomainChanged()
+    HardwareCounterSample sample(Moose::hardware_counters);
+
     _subdomain = Moose::INVALID_BLOCK_ID;
     _neighbor_subdomain = Moose::INVALID_BLOCK_ID;
-    typename RangeType::const_iterator el = range.begin();
-    for (el = range.begin(); el != range.end(); ++el)
-    {
-      if (!keepGoing())
-        break;
+    const bool need_interfaces = needInterfaces();
+    std::vector<BoundaryID> boundary_ids;
 
-      const Elem * elem = *el;
+    // Visits one element and its sides, returns false once the loop should stop
+    auto visit = [&](const Elem * elem) {
+      if (!keepGoing())
+        return false;
 
       preElement(elem);
 
       _old_subdomain = _subdomain;
       _subdomain = elem->subdomain_id();
       if (_subdomain != _old_subdomain)
+      {
+        sample.start(typeid(*this), _subdomain, _tid);
         subdomainChanged();
+        _need_internal_sides = needInternalSides(_subdomain);
+      }
 
       onElement(elem);
 
       for (unsigned int side = 0; side < elem->n_sides(); side++)
       {
-        std::vector<BoundaryID> boundary_ids = _mesh.getBoundaryIDs(elem, side);
+        _mesh.getMesh().get_boundary_info().boundary_ids(elem, side, boundary_ids);
 
         if (boundary_ids.size() > 0)
           for (std::vector<BoundaryID>::iterator it = boundary_ids.begin();
@@ -212,7 +242,8 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
             onBoundary(elem, side, *it);
 
         const Elem * neighbor = elem->neighbor_ptr(side);
-        if (neighbor != nullptr)
+        if (neighbor != nullptr &&
+            (_need_internal_sides || (need_interfaces && boundary_ids.size() > 0)))
         {
           preInternalSide(elem, side);
 
@@ -234,8 +265,28 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
       } // sides
       postElement(elem);
 
-    } // range
+      return true;
+    };
 
+    if (_mesh.groupElementsByType())
+    {
+      // Consecutive elements of the same subdomain and type keep the FE data of the last one
+      std::vector<const Elem *> elems(range.begin(), range.end());
+      std::stable_sort(elems.begin(), elems.end(), [](const Elem * a, const Elem * b) {
+        return std::make_pair(a->subdomain_id(), a->type()) <
+               std::make_pair(b->subdomain_id(), b->type());
+      });
+
+      for (const Elem * elem : elems)
+        if (!visit(elem))
+          break;
+    }
+    else
+      for (typename RangeType::const_iterator el = range.begin(); el != range.end(); ++el)
+        if (!visit(*el))
+          break;
+
+    sample.stop();
     post();
   }
   catch (MooseException & e)
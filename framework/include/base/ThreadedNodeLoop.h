@@ -96,6 +96,7 @@ ThreadedNodeLoop<RangeType, IteratorType>::operator()(const RangeType & range)
   {
     ParallelUniqueId puid;
     _tid = puid.id;
+    Moose::pinThread(_tid);
 
     pre();
 
@@ -34,6 +34,8 @@ public:
   UpdateErrorVectorsThread(UpdateErrorVectorsThread & x, Threads::split split);
 
   virtual void onElement(const Elem * elem) override;
+  virtual bool needInternalSides(SubdomainID /*subdomain*/) override { return false; }
+  virtual bool needInterfaces() override { return false; }
 
   void join(const UpdateErrorVectorsThread & /*y*/);
 
@@ -32,11 +32,17 @@ class FunctionNeumannBC : public IntegratedBC
 public:
   FunctionNeumannBC(const InputParameters & parameters);
 
+  /// Evaluates the function at all quadrature points of the side before the residual
+  virtual void computeResidual() override;
+
 protected:
   virtual Real computeQpResidual() override;
 
   /// The function being used for setting the value
   Function & _func;
+
+  /// The function values at the quadrature points of the current side
+  std::vector<Real> _func_values;
 };
 
 #endif // FUNCTIONNEUMANNBC_H
@@ -35,8 +35,13 @@ public:
 
   /**
    * Add Constraint object to the warehouse.
+   *
+   * NodeFaceConstraint objects are evaluated on all threads, so copies for threads other than 0
+   * may be added as well.  Those copies are only used for computing, all of the setup methods are
+   * called on the thread 0 objects alone.
+   *
    * @param object A std::shared_ptr of the object
-   * @param tid Not used.
+   * @param tid The thread the object belongs to, only NodeFaceConstraint objects may use tid > 0
    */
   void addObject(std::shared_ptr<Constraint> object, THREAD_ID tid = 0);
 
@@ -50,7 +55,7 @@ public:
   const std::vector<std::shared_ptr<ElemElemConstraint>> &
   getActiveElemElemConstraints(InterfaceID interface_id) const;
   const std::vector<std::shared_ptr<NodeFaceConstraint>> &
-  getActiveNodeFaceConstraints(BoundaryID boundary_id, bool displaced);
+  getActiveNodeFaceConstraints(BoundaryID boundary_id, bool displaced, THREAD_ID tid = 0);
   ///@}
 
   ///@{
@@ -60,7 +65,8 @@ public:
   bool hasActiveNodalConstraints() const;
   bool hasActiveFaceFaceConstraints(const std::string & interface) const;
   bool hasActiveElemElemConstraints(const InterfaceID interface_id) const;
-  bool hasActiveNodeFaceConstraints(BoundaryID boundary_id, bool displaced) const;
+  bool
+  hasActiveNodeFaceConstraints(BoundaryID boundary_id, bool displaced, THREAD_ID tid = 0) const;
   ///@}
 
   /**
@@ -79,11 +85,13 @@ protected:
   /// NodalConstraint objects
   MooseObjectWarehouse<NodalConstraint> _nodal_constraints;
 
-  /// NodeFaceConstraint objects (non-displaced)
-  std::map<BoundaryID, MooseObjectWarehouse<NodeFaceConstraint>> _node_face_constraints;
+  /// NodeFaceConstraint objects (non-displaced), for each thread
+  std::vector<std::map<BoundaryID, MooseObjectWarehouse<NodeFaceConstraint>>>
+      _node_face_constraints;
 
-  /// NodeFaceConstraint objects (displaced)
-  std::map<BoundaryID, MooseObjectWarehouse<NodeFaceConstraint>> _displaced_node_face_constraints;
+  /// NodeFaceConstraint objects (displaced), for each thread
+  std::vector<std::map<BoundaryID, MooseObjectWarehouse<NodeFaceConstraint>>>
+      _displaced_node_face_constraints;
 
   /// FaceFaceConstraints
   std::map<std::string, MooseObjectWarehouse<FaceFaceConstraint>> _face_face_constraints;
@@ -162,6 +162,26 @@ protected:
                                   bool warn_when_values_differ = false);
   ///@}
 
+  ///@{
+  /**
+   * Resolve the controllable parameter(s) of the given input file syntax or actual name once.
+   * The returned object holds pointers to the parameter values, so a Control that sets the same
+   * parameters repeatedly can call ControllableParameter::set() on it instead of searching the
+   * InputParameterWarehouse every time it executes.
+   * @param name The name of the parameter to retrieve.
+   * @param warn_when_values_diff When true, produce a warning if multiple controllable values share
+   *                              the given name but have varying values.
+   */
+  template <typename T>
+  ControllableParameter<T> getControllableParameter(const std::string & name,
+                                                    bool warn_when_values_differ = false);
+
+  template <typename T>
+  ControllableParameter<T>
+  getControllableParameterByName(const MooseObjectParameterName & desired,
+                                 bool warn_when_values_differ = false);
+  ///@}
+
 private:
   /// A reference to the InputParameterWarehouse which is used for access the parameter objects
   InputParameterWarehouse & _input_parameter_warehouse;
@@ -309,6 +329,22 @@ Control::setControllableValueByName(const std::string & tag,
   helper.set(value);
 }
 
+template <typename T>
+ControllableParameter<T>
+Control::getControllableParameter(const std::string & name, bool warn_when_values_differ)
+{
+  return getControllableParameterByName<T>(MooseObjectParameterName(getParam<std::string>(name)),
+                                           warn_when_values_differ);
+}
+
+template <typename T>
+ControllableParameter<T>
+Control::getControllableParameterByName(const MooseObjectParameterName & desired,
+                                        bool warn_when_values_differ)
+{
+  return getControllableParameterHelper<T>(desired, warn_when_values_differ, /*mark_as_set=*/true);
+}
+
 template <typename T>
 ControllableParameter<T>
 Control::getControllableParameterHelper(const MooseObjectParameterName & desired,
@@ -33,6 +33,9 @@ class BoundingValueNodalDamper : public NodalDamper
 public:
   BoundingValueNodalDamper(const InputParameters & parameters);
 
+  virtual bool hasDofDamping() const override { return true; }
+  virtual Real computeDofDamping(Real u, Real u_increment) override;
+
 protected:
   /// The maximum permissible value of the variable
   const Real & _max_value;
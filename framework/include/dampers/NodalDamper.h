@@ -49,6 +49,19 @@ public:
    */
   MooseVariable * getVariable() { return &_var; }
 
+  /**
+   * Whether this damper only depends on the nodal value and the increment of its variable. Such
+   * dampers are evaluated with computeDofDamping() in a pass over the degrees of freedom, without
+   * reinitializing the nodes.
+   */
+  virtual bool hasDofDamping() const { return false; }
+
+  /**
+   * Computes this Damper's damping from the value and the (negative) increment of one degree of
+   * freedom. Must be overridden when hasDofDamping() returns true.
+   */
+  virtual Real computeDofDamping(Real u, Real u_increment);
+
 protected:
   /**
    * This MUST be overridden by a child damper.
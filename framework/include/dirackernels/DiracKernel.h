@@ -31,6 +31,8 @@
 #include "ZeroInterface.h"
 #include "MeshChangedInterface.h"
 
+#include <unordered_map>
+
 // Forward Declarations
 class Assembly;
 class DiracKernel;
@@ -147,6 +149,15 @@ protected:
    */
   const Elem * addPoint(Point p, unsigned id = libMesh::invalid_uint);
 
+  /**
+   * Adds a batch of points with their (unique, valid) user-defined ids.
+   * This behaves like calling addPoint(Point, id) for each point, but
+   * the cache lookups are local and all of the points that need a
+   * PointLocator search are handled with a single collective call.
+   * Prefer this method in addPoints() when there are many points.
+   */
+  void addPoint(const std::vector<Point> & points, const std::vector<unsigned> & ids);
+
   /**
    * Returns the user-assigned ID of the current Dirac point if it
    * exits, and libMesh::invalid_uint otherwise.  Can be used e.g. in
@@ -228,13 +239,14 @@ protected:
 private:
   /// Data structure for caching user-defined IDs which can be mapped to
   /// specific std::pair<const Elem*, Point> and avoid the PointLocator Elem lookup.
-  typedef std::map<unsigned, std::pair<const Elem *, Point>> point_cache_t;
+  typedef std::unordered_map<unsigned, std::pair<const Elem *, Point>> point_cache_t;
   point_cache_t _point_cache;
 
   /// Map from Elem* to a list of (Dirac point, id) pairs which can be used
   /// in a user's computeQpResidual() routine to determine the user-defined ID for
   /// the current Dirac point, if one exists.
-  typedef std::map<const Elem *, std::vector<std::pair<Point, unsigned>>> reverse_cache_t;
+  typedef std::unordered_map<const Elem *, std::vector<std::pair<Point, unsigned>>>
+      reverse_cache_t;
   reverse_cache_t _reverse_point_cache;
 
   /// This function is used internally when the Elem for a
@@ -247,6 +259,14 @@ private:
   /// A helper function for addPoint(Point, id) for when
   /// id != invalid_uint.
   const Elem * addPointWithValidId(Point p, unsigned id);
+
+  /// Handles a point whose id was found in the local _point_cache.
+  /// Returns the Elem the point was added to (or NULL) and sets
+  /// need_find_point when the cached Elem no longer contains the
+  /// point.  Only local work is done, so it is safe to call on a
+  /// subset of the processors.
+  const Elem *
+  addCachedPoint(point_cache_t::iterator it, Point p, unsigned id, bool & need_find_point);
 };
 
 #endif
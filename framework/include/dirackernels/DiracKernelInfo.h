@@ -22,6 +22,7 @@
 
 #include <set>
 #include <map>
+#include <vector>
 #include <memory>
 
 // Forward declarations
@@ -88,7 +89,24 @@ public:
    */
   const Elem * findPoint(Point p, const MooseMesh & mesh);
 
+  /**
+   * Batched version of findPoint(): locates every Point in points and
+   * fills elems with the winning Elem (or NULL) for each of them.  The
+   * processor ownership is resolved with a single collective
+   * reduction, so this should be preferred over repeated calls to
+   * findPoint() when many points need to be located at once.
+   */
+  void findPoints(const std::vector<Point> & points,
+                  std::vector<const Elem *> & elems,
+                  const MooseMesh & mesh);
+
 protected:
+  /**
+   * Builds the PointLocator if needed and returns it.  This is a
+   * parallel_only method the first time it is called.
+   */
+  PointLocatorBase & pointLocator(const MooseMesh & mesh);
+
   /**
    * Check if two points are equal with respect to a tolerance
    */
@@ -0,0 +1,66 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MULTIRATETRANSIENT_H
+#define MULTIRATETRANSIENT_H
+
+#include "Transient.h"
+
+// Forward Declarations
+class MultirateTransient;
+
+template <>
+InputParameters validParams<MultirateTransient>();
+
+/**
+ * Transient executioner advancing a group of fast variables with smaller time steps than the
+ * rest of the nonlinear variables.
+ *
+ * Each step first solves for the slow variables over the full dt with the fast variables held at
+ * their values at the beginning of the step. The fast variables are then advanced in 'substeps'
+ * subcycles of dt / substeps with the slow variables held at their new values. All solves use
+ * the same nonlinear system and TimeIntegrator, the held variables are frozen through their
+ * residual and Jacobian rows. Stateful material properties are only advanced with the full step.
+ */
+class MultirateTransient : public Transient
+{
+public:
+  MultirateTransient(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual bool lastSolveConverged() override;
+
+protected:
+  virtual void solveCurrentStep() override;
+
+  /**
+   * Collect the local dofs of the given variables
+   */
+  void getVariableDofs(const std::vector<unsigned int> & vars, std::vector<dof_id_type> & dofs);
+
+  /// Number of subcycles of the fast variables per step
+  const unsigned int _substeps;
+
+  /// Variable numbers of the fast and of the slow variables
+  std::vector<unsigned int> _fast_vars;
+  std::vector<unsigned int> _slow_vars;
+
+  /// Old solution at the beginning of the step, restored after the subcycles
+  NumericVector<Number> & _step_old_solution;
+
+  /// Whether all subcycles of the last step converged
+  bool _subcycles_converged;
+};
+
+#endif // MULTIRATETRANSIENT_H
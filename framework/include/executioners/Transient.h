@@ -20,11 +20,14 @@
 // System includes
 #include <string>
 #include <fstream>
+#include <deque>
+#include <memory>
 
 // Forward Declarations
 class Transient;
 class TimeStepper;
 class FEProblemBase;
+class Backup;
 
 template <>
 InputParameters validParams<Transient>();
@@ -216,6 +219,34 @@ protected:
    */
   virtual void solveStep(Real input_dt = -1.0);
 
+  /**
+   * Solve the nonlinear system for the current step through the TimeStepper.
+   */
+  virtual void solveCurrentStep();
+
+  /**
+   * Store the values of the relaxed variables and postprocessors at the beginning of a step.
+   */
+  void initPicardRelaxation();
+
+  /**
+   * Replace the freshly transferred values of the relaxed variables and postprocessors with the
+   * relaxed (constant, Aitken or Anderson) Picard iterate.
+   */
+  void relaxPicardIterate();
+
+  /**
+   * Gather the relaxed values owned by this processor. Postprocessor values are only stored on
+   * processor zero so that the parallel inner products count them once.
+   */
+  void gatherRelaxedValues(std::vector<Real> & values);
+
+  /// Scatter the relaxed values back into the variables and postprocessors
+  void scatterRelaxedValues(const std::vector<Real> & values);
+
+  /// Parallel inner product of two vectors of relaxed values
+  Real relaxedDot(const std::vector<Real> & a, const std::vector<Real> & b) const;
+
   /// Here for backward compatibility
   FEProblemBase & _problem;
 
@@ -279,6 +310,12 @@ protected:
   Real & _target_time;
   bool _use_multiapp_dt;
 
+  /// Whether to snapshot the UserObject and Postprocessor data for rejected steps
+  const bool _snapshot_restartable_data;
+
+  /// The in-memory snapshot taken at the beginning of the current step
+  std::shared_ptr<Backup> _step_snapshot;
+
   /**
    * Picard Related
    */
@@ -292,6 +329,34 @@ protected:
   Real _picard_rel_tol;
   Real _picard_abs_tol;
 
+  /// The acceleration of the Picard iterations: none, constant, aitken or anderson
+  const MooseEnum _picard_relaxation;
+  /// The (initial, for aitken) relaxation factor
+  const Real _relaxation_factor;
+  /// The number of previous iterates used by Anderson mixing
+  const unsigned int _anderson_depth;
+  /// The variables and postprocessors whose values are relaxed
+  const std::vector<VariableName> _relaxed_variables;
+  const std::vector<PostprocessorName> _relaxed_postprocessors;
+  /// The local DOFs of each relaxed variable for the current step
+  std::vector<std::vector<dof_id_type>> _relaxed_dofs;
+  /// The current relaxed iterate and the previous iterate and residual
+  std::vector<Real> _relaxed_iterate;
+  std::vector<Real> _relaxed_iterate_old;
+  std::vector<Real> _relaxed_residual_old;
+  /// The current Aitken relaxation factor
+  Real _aitken_factor;
+  /// The Anderson history of iterate and residual differences
+  std::deque<std::vector<Real>> _anderson_iterate_diffs;
+  std::deque<std::vector<Real>> _anderson_residual_diffs;
+
+  /// Number of time steps between load balance checks (0 to never repartition)
+  const unsigned int _repartition_interval;
+  /// Load imbalance above which the mesh is repartitioned
+  const Real _repartition_imbalance;
+  /// Postprocessor value used as the load imbalance (nullptr to use the element residual times)
+  const PostprocessorValue * const _repartition_imbalance_pp;
+
   ///should detailed diagnostic output be printed
   bool _verbose;
 
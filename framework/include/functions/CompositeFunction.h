@@ -33,10 +33,15 @@ public:
   CompositeFunction(const InputParameters & parameters);
 
   virtual Real value(Real t, const Point & pt) override;
+  virtual void
+  valueBatch(Real t, const MooseArray<Point> & points, std::vector<Real> & values) override;
 
 private:
   const Real _scale_factor;
   std::vector<Function *> _f;
+
+  /// Values of one of the functions at the points of valueBatch()
+  std::vector<Real> _f_values;
 };
 
 #endif // COMPOSITE_H
@@ -23,6 +23,7 @@
 #include "Restartable.h"
 #include "MeshChangedInterface.h"
 #include "ScalarCoupleable.h"
+#include "MooseArray.h"
 
 // libMesh
 #include "libmesh/vector_value.h"
@@ -73,6 +74,15 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at a set of points, e.g. all quadrature points of an element. By
+   * default this calls value() for each point, derived classes may provide a faster evaluation.
+   * \param t The time
+   * \param points The Points in space (x,y,z)
+   * \param values The function values at the points (resized to match points)
+   */
+  virtual void valueBatch(Real t, const MooseArray<Point> & points, std::vector<Real> & values);
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
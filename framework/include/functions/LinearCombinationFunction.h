@@ -32,6 +32,8 @@ public:
   LinearCombinationFunction(const InputParameters & parameters);
 
   virtual Real value(Real t, const Point & pt) override;
+  virtual void
+  valueBatch(Real t, const MooseArray<Point> & points, std::vector<Real> & values) override;
   virtual RealVectorValue vectorValue(Real t, const Point & p) override;
   virtual RealGradient gradient(Real t, const Point & p) override;
 
@@ -39,6 +41,9 @@ private:
   std::vector<Real> _w;
 
   std::vector<Function *> _f;
+
+  /// Values of one of the functions at the points of valueBatch()
+  std::vector<Real> _f_values;
 };
 
 #endif // LINEARCOMBINATIONFUNCTION_H
@@ -51,6 +51,13 @@ public:
    */
   virtual Real value(Real t, const Point & pt) override;
 
+  /**
+   * Evaluate the equation at a set of points
+   * @see MooseParsedFunctionWrapper::evaluateBatch
+   */
+  virtual void
+  valueBatch(Real t, const MooseArray<Point> & points, std::vector<Real> & values) override;
+
   /**
    * Evaluate the gradient of the function. This is computed in libMesh
    * through automatic symbolic differentiation.
@@ -16,6 +16,7 @@
 #define MOOSEPARSEDFUNCTIONWRAPPER_H
 
 // MOOSE includes
+#include "MooseArray.h"
 #include "MooseError.h"
 #include "MooseTypes.h"
 
@@ -67,6 +68,12 @@ public:
   template <typename T>
   T evaluate(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at a set of points. The Postprocessor and scalar variable values
+   * are only updated once for the whole set instead of once per point.
+   */
+  void evaluateBatch(Real t, const MooseArray<Point> & points, std::vector<Real> & values);
+
   /**
    * Evaluate the gradient of the function which libMesh provides through
    * automatic differentiation
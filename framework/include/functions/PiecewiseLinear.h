@@ -40,6 +40,13 @@ public:
    */
   virtual Real value(Real t, const Point & pt) override;
 
+  /**
+   * Get the values of the function at a set of points, with a single table lookup when the
+   * function depends on time only
+   */
+  virtual void
+  valueBatch(Real t, const MooseArray<Point> & points, std::vector<Real> & values) override;
+
   /**
    * Get the time derivative of the function (based on time only)
    * \param t The time
@@ -51,6 +58,10 @@ public:
   virtual Real integral() override;
 
   virtual Real average() override;
+
+protected:
+  /// Interval found by the last table lookup, used to speed up the next one
+  unsigned int _interval_hint;
 };
 
 #endif
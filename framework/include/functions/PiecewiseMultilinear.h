@@ -49,6 +49,15 @@ public:
    */
   virtual Real value(Real t, const Point & pt) override;
 
+  /**
+   * Evaluate the function at time t for all the points in \p pts, which is cheaper than
+   * calling value() for each of them
+   * @param t The time
+   * @param pts The points
+   * @param values Upon return will contain the function value at each of the points
+   */
+  void values(Real t, const std::vector<Point> & pts, std::vector<Real> & values);
+
 private:
   /// object to provide function evaluations at points on the grid
   std::unique_ptr<GriddedData> _gridded_data;
@@ -67,12 +76,20 @@ private:
   /// the grid
   std::vector<std::vector<Real>> _grid;
 
+  /// the function values at the grid points, f[i,j,k,l] is _fcn[i + j*_step[1] + ...]
+  std::vector<Real> _fcn;
+
+  /// the distance in _fcn between neighboring grid points along each axis
+  std::vector<std::size_t> _step;
+
   /**
-   * This does the core work.  Given a point, pt, defined
-   * on the grid (not the MOOSE simulation reference frame),
-   * interpolate the gridded data to this point
+   * This does the core work.  Given t and p, convert them to a point
+   * on the grid (not the MOOSE simulation reference frame) and
+   * interpolate the gridded data to this point.  The number of
+   * axes is a template parameter so that no memory is allocated.
    */
-  Real sample(const std::vector<Real> & pt);
+  template <unsigned int D>
+  Real sample(Real t, const Point & p) const;
 
   /**
    * Operates on monotonically increasing in_arr.
@@ -85,10 +102,10 @@ private:
    * @param lower_x Upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
    */
-  void getNeighborIndices(std::vector<Real> in_arr,
+  void getNeighborIndices(const std::vector<Real> & in_arr,
                           Real x,
                           unsigned int & lower_x,
-                          unsigned int & upper_x);
+                          unsigned int & upper_x) const;
 };
 
 #endif // PIECEWISEMULTILINEAR_H
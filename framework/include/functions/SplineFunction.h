@@ -32,6 +32,8 @@ public:
   SplineFunction(const InputParameters & parameters);
 
   virtual Real value(Real t, const Point & p) override;
+  virtual void
+  valueBatch(Real t, const MooseArray<Point> & points, std::vector<Real> & values) override;
   virtual RealGradient gradient(Real t, const Point & p) override;
 
   virtual Real derivative(const Point & p);
@@ -0,0 +1,98 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BOUNDINGVOLUMEHIERARCHY_H
+#define BOUNDINGVOLUMEHIERARCHY_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// C++ includes
+#include <vector>
+
+/**
+ * A tree of axis aligned bounding boxes (AABB tree) over a set of faces, each
+ * given by its nodes.  The topology of the tree is built once with median
+ * splits of the face centroids; when the nodes move (e.g. on the displaced
+ * mesh) refit() recomputes the boxes bottom-up in O(n) while keeping the topology.
+ */
+class BoundingVolumeHierarchy
+{
+public:
+  /**
+   * Build the tree over \p faces.  The node pointers must stay valid for the life of the tree.
+   */
+  BoundingVolumeHierarchy(const std::vector<std::vector<const Node *>> & faces);
+
+  /**
+   * Recompute the boxes from the current positions of the nodes
+   */
+  void refit();
+
+  /**
+   * The node of any face closest to \p p, or nullptr if there are no faces.  This is thread safe.
+   */
+  const Node * nearestNode(const Point & p) const;
+
+  /**
+   * The number of faces in the tree
+   */
+  std::size_t numFaces() const { return _face_offsets.size() - 1; }
+
+private:
+  struct TreeNode
+  {
+    /// The corners of the box
+    Point _min;
+    Point _max;
+
+    /// For a leaf the index of its first face in _faces, otherwise the index of the right child
+    /// (the left child always directly follows its parent)
+    unsigned int _first;
+
+    /// The number of faces of a leaf, 0 for the other nodes
+    unsigned int _count;
+  };
+
+  /**
+   * Build the tree below node \p index over _faces[begin, end)
+   */
+  void build(unsigned int index,
+             unsigned int begin,
+             unsigned int end,
+             const std::vector<Point> & centroids);
+
+  /**
+   * Squared distance from \p p to the box of \p tree_node (0 inside)
+   */
+  static Real distanceSquared(const TreeNode & tree_node, const Point & p);
+
+  /// The nodes of the tree, in depth first order
+  std::vector<TreeNode> _tree;
+
+  /// The faces in the order of the leaves
+  std::vector<unsigned int> _faces;
+
+  /// The nodes of face i are _face_nodes[_face_offsets[i]] to _face_nodes[_face_offsets[i + 1] - 1]
+  std::vector<const Node *> _face_nodes;
+  std::vector<std::size_t> _face_offsets;
+
+  /// The maximum number of faces in a leaf
+  static const unsigned int _leaf_size = 4;
+};
+
+#endif // BOUNDINGVOLUMEHIERARCHY_H
@@ -86,6 +86,12 @@ public:
    */
   void reinit();
 
+  /**
+   * Called at the beginning of each time step, lets the penetration locators with a per time step
+   * update policy search again.
+   */
+  void timestepSetup();
+
   /**
    * Clear out the Penetration Locators so they will redo the search.
    */
@@ -98,6 +104,11 @@ public:
    */
   Real maxPatchPercentage();
 
+  /**
+   * Estimate of the bytes held by all penetration and nearest node locators
+   */
+  std::size_t memoryFootprint() const;
+
   // protected:
   SubProblem & _subproblem;
   MooseMesh & _mesh;
@@ -119,6 +130,11 @@ protected:
   std::map<unsigned int, unsigned int> _boundary_to_mortarboundary;
 
 private:
+  /**
+   * Whether \p boundary_id is the "fictitious" boundary of the quadrature nodes of a real boundary
+   */
+  bool isQuadratureBoundary(unsigned int boundary_id) const;
+
   /**
    * Add Quadrature Nodes to the Mesh in support of Quadrature based penetration location and
    * nearest node searching.
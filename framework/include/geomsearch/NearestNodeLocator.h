@@ -47,6 +47,11 @@ public:
    */
   void reinit();
 
+  /**
+   * Estimate of the bytes held by the nearest node information and the node patches
+   */
+  std::size_t memoryFootprint() const;
+
   /**
    * Valid to call this after findNodes() has been called to get the distance to the nearest node.
    */
@@ -81,6 +86,35 @@ public:
   };
 
 protected:
+  /**
+   * Build the patches of the slave nodes in the range from the trial master nodes at their current
+   * positions.
+   */
+  void buildPatches(const NodeIdRange & slave_node_range);
+
+  /**
+   * Rebuild only the patches of the slave nodes that drifted more than the patch update tolerance
+   * relative to the master surface since their patch was built.
+   */
+  void updatePatches();
+
+  /**
+   * Data saved when the patch of a slave node is built, used to measure how far the node has drifted
+   * since then.
+   */
+  struct PatchReference
+  {
+    /// Position of the slave node
+    Point _slave_position;
+
+    /// The master node closest to the slave node and its position
+    dof_id_type _master_node;
+    Point _master_position;
+
+    /// Distance from the slave node to the furthest node of its patch
+    Real _radius;
+  };
+
   SubProblem & _subproblem;
 
   MooseMesh & _mesh;
@@ -98,6 +132,12 @@ public:
 
   std::map<dof_id_type, std::vector<dof_id_type>> _neighbor_nodes;
 
+  /// The master nodes patches are built from (those within the inflated bounding box)
+  std::vector<dof_id_type> _trial_master_nodes;
+
+  /// Reference data of the patch of each slave node (only kept for incremental patch updates)
+  std::map<dof_id_type, PatchReference> _patch_reference;
+
   // The following parameter controls the patch size that is searched for each nearest neighbor
   static const unsigned int _patch_size;
 
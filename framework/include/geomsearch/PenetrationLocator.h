@@ -29,6 +29,7 @@ class SubProblem;
 class MooseMesh;
 class GeometricSearchData;
 class NearestNodeLocator;
+class BoundingVolumeHierarchy;
 
 class PenetrationLocator : Restartable
 {
@@ -49,6 +50,11 @@ public:
    */
   void reinit();
 
+  /**
+   * Estimate of the bytes held by the penetration information of the tracked nodes
+   */
+  std::size_t memoryFootprint() const;
+
   Real penetrationDistance(dof_id_type node_id);
   RealVectorValue penetrationNormal(dof_id_type node_id);
 
@@ -58,6 +64,14 @@ public:
     NSM_NODAL_NORMAL_BASED
   };
 
+  /// When GeometricSearchData::update() redoes the search
+  enum UPDATE_POLICY
+  {
+    UP_ITERATION, ///< Every time (every residual evaluation on the displaced mesh)
+    UP_TIMESTEP,  ///< Once per time step
+    UP_TOLERANCE  ///< When a node moved more than the tolerance since the last search
+  };
+
   SubProblem & _subproblem;
 
   Real normDistance(const Elem & elem,
@@ -91,6 +105,33 @@ public:
   void setTangentialTolerance(Real tangential_tolerance);
   void setNormalSmoothingDistance(Real normal_smoothing_distance);
   void setNormalSmoothingMethod(std::string nsmString);
+
+  /**
+   * Find the candidate master faces of each slave node through a bounding volume hierarchy over
+   * the master faces instead of the patches of the NearestNodeLocator, so the search does not
+   * depend on the patch size
+   */
+  void setUseBoundingVolumeHierarchy(bool state);
+
+  /**
+   * Set when GeometricSearchData::update() redoes the search, meant for quadrature penetration
+   * locators whose users can live with a slightly stale contact point during the nonlinear
+   * iterations
+   * @param policy The update policy
+   * @param tolerance The largest motion of a slave node or of a node of a contacted master face
+   * tolerated without a new search (UP_TOLERANCE only)
+   */
+  void setUpdatePolicy(UPDATE_POLICY policy, Real tolerance = 0.0);
+
+  /**
+   * Whether the search has to be redone according to the update policy (collective)
+   */
+  bool needsUpdate();
+
+  /**
+   * Called at the beginning of each time step
+   */
+  void timestepSetup();
   Real getTangentialTolerance() { return _tangential_tolerance; }
 
 protected:
@@ -103,6 +144,24 @@ protected:
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to
                                    // perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
+
+  /// Whether to use _bvh to find the candidate master faces
+  bool _use_bvh;
+  /// Tree over the master faces, built on the first search and refit on the following ones
+  std::unique_ptr<BoundingVolumeHierarchy> _bvh;
+
+  /// The update policy and its tolerance
+  UPDATE_POLICY _update_policy;
+  Real _update_tolerance;
+
+  /// Whether no search has been done in the current time step yet
+  bool _timestep_update_pending;
+
+  /// Whether any search has been done
+  bool _searched;
+
+  /// Positions of the tracked nodes at the last search (UP_TOLERANCE only)
+  std::map<dof_id_type, Point> _reference_positions;
 };
 
 /**
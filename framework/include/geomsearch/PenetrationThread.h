@@ -21,6 +21,7 @@
 
 // Forward declarations
 class MooseVariable;
+class BoundingVolumeHierarchy;
 
 class PenetrationThread
 {
@@ -40,9 +41,8 @@ public:
                     FEType & fe_type,
                     NearestNodeLocator & nearest_node,
                     const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
-                    std::vector<dof_id_type> & elem_list,
-                    std::vector<unsigned short int> & side_list,
-                    std::vector<boundary_id_type> & id_list);
+                    const std::map<dof_id_type, std::vector<unsigned int>> & master_sides,
+                    const BoundingVolumeHierarchy * bvh = nullptr);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -79,11 +79,11 @@ protected:
 
   const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
 
-  std::vector<dof_id_type> & _elem_list;
-  std::vector<unsigned short int> & _side_list;
-  std::vector<boundary_id_type> & _id_list;
+  /// The sides on the master boundary of each element having any
+  const std::map<dof_id_type, std::vector<unsigned int>> & _master_sides;
 
-  unsigned int _n_elems;
+  /// If not null, the nearest master node is found with this tree instead of _nearest_node
+  const BoundingVolumeHierarchy * _bvh;
 
   THREAD_ID _tid;
 
@@ -20,12 +20,14 @@
 
 // Forward declarations
 class MooseMesh;
+class KDTree;
 
 class SlaveNeighborhoodThread
 {
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
+                          const KDTree & master_tree,
                           const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
                           const unsigned int patch_size);
 
@@ -52,11 +54,18 @@ protected:
   /// Nodes to search against
   const std::vector<dof_id_type> & _trial_master_nodes;
 
+  /// Spatial search tree over the positions of the trial master nodes (in the same order)
+  const KDTree & _master_tree;
+
   /// Node to elem map
   const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
 
   /// The number of nodes to keep
   unsigned int _patch_size;
+
+  /// Scratch space for the tree searches
+  std::vector<std::size_t> _indices;
+  std::vector<Real> _distances;
 };
 
 #endif // SLAVENEIGHBORHOODTHREAD_H
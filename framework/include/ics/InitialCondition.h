@@ -31,6 +31,9 @@
 #include "libmesh/vector_value.h"
 #include "libmesh/elem.h"
 
+// C++ includes
+#include <unordered_map>
+
 // forward declarations
 class InitialCondition;
 class FEProblemBase;
@@ -38,6 +41,14 @@ class SystemBase;
 class Assembly;
 class MooseVariable;
 
+namespace libMesh
+{
+template <typename>
+class FEGenericBase;
+typedef FEGenericBase<Real> FEBase;
+class QBase;
+}
+
 template <>
 InputParameters validParams<InitialCondition>();
 
@@ -70,6 +81,12 @@ public:
 
   virtual void compute();
 
+  /**
+   * Releases the vertex values stored while computing with cache_vertex_values enabled,
+   * called once the initial conditions have been projected.
+   */
+  void clearCachedValues();
+
   /**
    * The value of the variable at a point.
    *
@@ -144,6 +161,28 @@ protected:
 
   /// If set, UOs retrieved by this IC will not be executed before this IC
   const bool _ignore_uo_dependency;
+
+  /// If set, the value on a vertex is only computed by the first element visiting it
+  const bool _cache_vertex_values;
+
+  /// The values computed on vertices (by dof index) when _cache_vertex_values is set
+  std::unordered_map<dof_id_type, Number> _vertex_values;
+
+private:
+  /// The FE object and quadrature rules used for projecting onto elements of one dimension
+  struct ProjectionFE
+  {
+    std::unique_ptr<FEBase> fe;
+    std::unique_ptr<QBase> qrule;
+    std::unique_ptr<QBase> qedgerule;
+    std::unique_ptr<QBase> qsiderule;
+  };
+
+  /// Returns the projection FE data for the given element dimension, building it on first use
+  ProjectionFE & projectionFE(unsigned int dim);
+
+  /// The projection FE data for every element dimension this object has visited
+  std::map<unsigned int, ProjectionFE> _projection_fe;
 };
 
 template <typename T>
@@ -0,0 +1,71 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ADKERNEL_H
+#define ADKERNEL_H
+
+#include "Kernel.h"
+
+// Forward Declarations
+class ADKernel;
+
+template <>
+InputParameters validParams<ADKernel>();
+
+/**
+ * Base class for kernels whose Jacobian is computed exactly by forward mode automatic
+ * differentiation of the residual.
+ *
+ * Derived classes implement computeQpADResidual() in terms of _ad_u, _ad_grad_u,
+ * adCoupledValue(), adCoupledGradient() and ADReal material properties. The element residual is
+ * evaluated once per element together with its derivatives with respect to the degrees of
+ * freedom of all nonlinear variables, from which the diagonal and all off-diagonal Jacobian
+ * blocks are extracted.
+ */
+class ADKernel : public Kernel
+{
+public:
+  ADKernel(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+
+protected:
+  /// The residual at the current test function and quadrature point, with its derivatives
+  virtual ADReal computeQpADResidual() = 0;
+
+  /// The value of computeQpADResidual()
+  virtual Real computeQpResidual() override;
+
+  /// Evaluates the element residual with its derivatives into _ad_local_re
+  void computeADResidual();
+
+  /// Holds the solution at the current quadrature points, with derivatives
+  const ADVariableValue & _ad_u;
+
+  /// Holds the solution gradient at the current quadrature points, with derivatives
+  const ADVariableGradient & _ad_grad_u;
+
+  /// The element residual with its derivatives, one entry per test function
+  std::vector<ADReal> _ad_local_re;
+
+  /// The element _ad_local_re belongs to, nullptr when it has to be recomputed
+  const Elem * _ad_elem;
+};
+
+#endif // ADKERNEL_H
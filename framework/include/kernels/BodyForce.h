@@ -37,12 +37,21 @@ class BodyForce : public Kernel
 public:
   BodyForce(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
   virtual Real computeQpResidual() override;
 
+  /// Evaluates the function at all quadrature points at once
+  virtual bool computeResidualBatch() override;
+
   const Real & _value;
   Function & _function;
   const PostprocessorValue * const _postprocessor;
+
+  /// Whether the batched residual may be used (not the case in derived classes, which may
+  /// change the weak form by overriding computeQpResidual())
+  bool _use_batch;
 };
 
 #endif
@@ -31,10 +31,18 @@ class Diffusion : public Kernel
 public:
   Diffusion(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
   virtual Real computeQpResidual() override;
 
   virtual Real computeQpJacobian() override;
+
+  virtual bool computeResidualBatch() override;
+
+  /// Whether the batched residual may be used (not the case in derived classes, which may
+  /// change the weak form by overriding computeQpResidual())
+  bool _use_batch;
 };
 
 #endif /* DIFFUSION_H */
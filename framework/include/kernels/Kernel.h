@@ -47,6 +47,29 @@ protected:
   virtual void precalculateJacobian() {}
   virtual void precalculateOffDiagJacobian(unsigned int /* jvar */) {}
 
+  /**
+   * Opt-in batched residual evaluation.  Kernels whose weak form is
+   *   R_i = sum_qp JxW coord (value[qp] * test_i[qp] + flux[qp] * grad_test_i[qp])
+   * can override this to fill _batch_value and/or _batch_flux for all quadrature points at
+   * once and return true.  The residual is then assembled in one tight loop over (i, qp)
+   * instead of calling computeQpResidual() for every pair.  Leave a vector empty if its
+   * term is not present.
+   */
+  virtual bool computeResidualBatch() { return false; }
+
+  /**
+   * Add the batched residual of this kernel (see computeResidualBatch()) to \p local_re.
+   * @return false if the kernel did not provide a batched residual
+   */
+  bool accumulateResidualBatch(DenseVector<Number> & local_re);
+
+  /**
+   * accumulateResidualBatch() for elements with N_DOFS test functions and N_QP quadrature points
+   * known at compile time
+   */
+  template <unsigned int N_DOFS, unsigned int N_QP>
+  void accumulateResidualBatchFixed(DenseVector<Number> & local_re);
+
   /// Holds the solution at current quadrature points
   const VariableValue & _u;
 
@@ -58,6 +81,12 @@ protected:
 
   /// Derivative of u_dot with respect to u
   const VariableValue & _du_dot_du;
+
+  /// Coefficients of the test functions at each quadrature point, see computeResidualBatch()
+  std::vector<Real> _batch_value;
+
+  /// Coefficients of the test function gradients at each quadrature point
+  std::vector<RealGradient> _batch_flux;
 };
 
 #endif /* KERNEL_H */
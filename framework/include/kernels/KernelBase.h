@@ -100,6 +100,9 @@ public:
 
   virtual bool isEigenKernel() const { return _eigen_kernel; }
 
+  /// Whether or not the element Jacobian contributions of this Kernel can be reused
+  bool isJacobianConstant() const { return _jacobian_constant; }
+
 protected:
   /// Reference to this kernel's SubProblem
   SubProblem & _subproblem;
@@ -177,6 +180,9 @@ protected:
   std::vector<AuxVariableName> _diag_save_in_strings;
 
   bool _eigen_kernel;
+
+  /// True if the Jacobian of this Kernel does not depend on the solution
+  const bool _jacobian_constant;
 };
 
 #endif /* KERNELBASE_H */
@@ -28,13 +28,21 @@ class TimeDerivative : public TimeKernel
 public:
   TimeDerivative(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual void computeJacobian() override;
 
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
 
+  virtual bool computeResidualBatch() override;
+
   bool _lumping;
+
+  /// Whether the batched residual may be used (not the case in derived classes, which may
+  /// change the weak form by overriding computeQpResidual())
+  bool _use_batch;
 };
 
 #endif // TIMEDERIVATIVE_H
@@ -34,6 +34,8 @@ class UserForcingFunction : public Kernel
 public:
   UserForcingFunction(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
   /**
    * Evaluate f at the current quadrature point.
@@ -45,7 +47,14 @@ protected:
    */
   virtual Real computeQpResidual() override;
 
+  /// Evaluates the function at all quadrature points at once
+  virtual bool computeResidualBatch() override;
+
   Function & _func;
+
+  /// Whether the batched residual may be used (not the case in derived classes, which may
+  /// change the weak form by overriding computeQpResidual())
+  bool _use_batch;
 };
 
 #endif // USERFORCINGFUNCTION_H
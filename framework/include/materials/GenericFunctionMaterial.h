@@ -38,6 +38,7 @@ public:
 
 protected:
   virtual void initQpStatefulProperties() override;
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
 
   std::vector<std::string> _prop_names;
@@ -58,6 +59,9 @@ private:
 
   /// Flag for calling declareProperyOld/Older
   bool _enable_stateful;
+
+  /// Buffer for the function values at all quadrature points
+  std::vector<Real> _values;
 };
 
 #endif // GENERICFUNCTIONMATERIAL_H
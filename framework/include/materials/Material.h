@@ -157,6 +157,22 @@ public:
    */
   virtual const std::set<std::string> & getSuppliedItems() override { return _supplied_props; }
 
+  /**
+   * Return the ids of the properties accessed with declareProperty
+   */
+  const std::set<unsigned int> & getSuppliedPropIDs() const { return _supplied_prop_ids; }
+
+  /**
+   * Returns true if this material declares an old or older property
+   */
+  bool hasStatefulProperties() const { return _has_stateful_property; }
+
+  /**
+   * Returns true if this material is only computed on boundary sides where its properties are
+   * consumed (see FEProblemBase::computeMaterialsOnDemand)
+   */
+  bool computeOnDemand() const { return _compute_on_demand; }
+
   void checkStatefulSanity() const;
 
   /**
@@ -266,6 +282,9 @@ protected:
   /// Options of the constantness level of the material
   const ConstantTypeEnum _constant_option;
 
+  /// Whether the material is only computed on the boundary sides its properties are consumed on
+  const bool _compute_on_demand;
+
   enum QP_Data_Type
   {
     CURR,
@@ -60,6 +60,12 @@ public:
 
   virtual unsigned int size() const = 0;
 
+  /**
+   * The number of bytes held by the values at the quadrature points (memory owned by the
+   * values themselves, e.g. the entries of a std::vector, is not counted)
+   */
+  virtual std::size_t memorySize() const = 0;
+
   /**
    * Resizes the property to the size n
    */
@@ -141,6 +147,8 @@ public:
 
   unsigned int size() const { return _value.size(); }
 
+  virtual std::size_t memorySize() const { return _value.size() * sizeof(T); }
+
   /**
    * Get element i out of the array.
    */
@@ -250,16 +258,16 @@ template <typename T>
 inline void
 MaterialProperty<T>::store(std::ostream & stream)
 {
-  for (unsigned int i = 0; i < _value.size(); i++)
-    storeHelper(stream, _value[i], NULL);
+  if (_value.size())
+    dataStoreContiguous(stream, &_value[0], _value.size(), NULL);
 }
 
 template <typename T>
 inline void
 MaterialProperty<T>::load(std::istream & stream)
 {
-  for (unsigned int i = 0; i < _value.size(); i++)
-    loadHelper(stream, _value[i], NULL);
+  if (_value.size())
+    dataLoadContiguous(stream, &_value[0], _value.size(), NULL);
 }
 
 /**
@@ -18,6 +18,11 @@
 #include "Moose.h"
 #include "MaterialProperty.h"
 #include "HashMap.h"
+#include "RestartableData.h"
+
+// C++ includes
+#include <array>
+#include <set>
 
 // Forward declarations
 class Material;
@@ -33,7 +38,8 @@ class QBase;
 /**
  * Stores the stateful material properties computed by materials.
  *
- * Thread-safe
+ * Thread-safe: the element map may be inserted into concurrently, and swap()/swapBack()
+ * take no global lock.
  */
 class MaterialPropertyStorage
 {
@@ -179,51 +185,83 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
+  /**
+   * Only store the old and older values of the given stateful properties. The old and older
+   * values of the other properties declared stateful keep their default values in MaterialData.
+   * Must be called before any material is constructed.
+   */
+  void restrictStatefulProperties(const std::set<std::string> & prop_names);
+
+  /**
+   * @return Whether old or older values of a property were requested that are not stored, see
+   * restrictStatefulProperties()
+   */
+  bool hasUnstoredStatefulProperties() const { return _has_unstored_stateful_props; }
+
+  /**
+   * The current, old and older stateful properties on one element side.  All states are
+   * kept together so that a single lookup finds everything swap() needs; which entry
+   * holds which state is given by stateSlot().
+   */
+  typedef std::array<MaterialProperties, 3> PropsStates;
+
+  /// Stateful properties of every element, indexed by [element][side]
+  typedef HashMap<const Elem *, std::vector<PropsStates>> PropsMap;
+
   ///@{
   /**
    * Access methods to the stored material property data
    *
    */
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & props()
-  {
-    return *_props_elem;
-  }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOld()
-  {
-    return *_props_elem_old;
-  }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOlder()
-  {
-    return *_props_elem_older;
-  }
-  const HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & props() const
-  {
-    return *_props_elem;
-  }
-  const HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOld() const
-  {
-    return *_props_elem_old;
-  }
-  const HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOlder() const
-  {
-    return *_props_elem_older;
-  }
+  const PropsMap & propsMap() const { return _props_elem; }
   MaterialProperties & props(const Elem * elem, unsigned int side)
   {
-    return (*_props_elem)[elem][side];
+    return propsStates(elem, side)[_state_slot[0]];
   }
   MaterialProperties & propsOld(const Elem * elem, unsigned int side)
   {
-    return (*_props_elem_old)[elem][side];
+    return propsStates(elem, side)[_state_slot[1]];
   }
   MaterialProperties & propsOlder(const Elem * elem, unsigned int side)
   {
-    return (*_props_elem_older)[elem][side];
+    return propsStates(elem, side)[_state_slot[2]];
   }
   ///@}
 
+  /**
+   * The entry of PropsStates holding the given state
+   * @param state 0 for current, 1 for old and 2 for older properties
+   */
+  unsigned int stateSlot(unsigned int state) const { return _state_slot[state]; }
+
+  /// Whether or not properties are stored for \p elem
+  bool hasElem(const Elem * elem) const { return _props_elem.contains(elem); }
+
+  /**
+   * Reserve room for the properties of \p n_elems elements so that threads initializing
+   * stateful properties for different elements do not have to wait on rehashing.
+   */
+  void reserve(std::size_t n_elems) { _props_elem.reserve(n_elems); }
+
+  ///@{
+  /**
+   * Store/load one state (see stateSlot()) of the properties on every element side.  The record
+   * of each element is prefixed with its size, loading skips the elements that properties are
+   * not stored for, so the states written by several processors can be loaded one after the
+   * other when recovering on a different number of processors.
+   */
+  void storeState(std::ostream & stream, unsigned int state, void * context);
+  void loadState(std::istream & stream, unsigned int state, void * context);
+  ///@}
+
   bool hasProperty(const std::string & prop_name) const;
 
+  /**
+   * Estimate of the bytes held by the stored current, old and older property values of all
+   * element sides
+   */
+  std::size_t memoryFootprint() const;
+
   /// The addProperty functions are idempotent - calling multiple times with
   /// the same name will provide the same id and works fine.
   unsigned int addProperty(const std::string & prop_name);
@@ -245,10 +283,14 @@ public:
   }
 
 protected:
-  // indexing: [element][side]->material_properties
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> * _props_elem;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> * _props_elem_old;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> * _props_elem_older;
+  /// All states of the stateful properties on an element side, creating them as needed
+  PropsStates & propsStates(const Elem * elem, unsigned int side);
+
+  // indexing: [element][side][slot]->material_properties
+  PropsMap _props_elem;
+
+  /// The entry of each PropsStates holding the current, old and older properties
+  std::array<unsigned int, 3> _state_slot;
 
   /// mapping from property name to property ID
   /// NOTE: this is static so the property numbering is global within the simulation (not just FEProblemBase - should be useful when we will use material properties from
@@ -267,6 +309,15 @@ protected:
    */
   bool _has_older_prop;
 
+  /// Whether only the stateful properties in _stored_stateful_props are stored
+  bool _restrict_stateful_props;
+
+  /// The stateful properties stored when _restrict_stateful_props is set
+  std::set<std::string> _stored_stateful_props;
+
+  /// Whether a property was requested stateful but is not stored
+  bool _has_unstored_stateful_props;
+
   /// mapping from property ID to property name
   std::map<unsigned int, std::string> _prop_names;
   /// the vector of stateful property ids (the vector index is the map to stateful prop_id)
@@ -283,26 +334,31 @@ private:
                  unsigned int n_qpoints);
 };
 
+template <>
+struct RestartableDataByElement<MaterialPropertyStorage> : std::true_type
+{
+};
+
 template <>
 inline void
 dataStore(std::ostream & stream, MaterialPropertyStorage & storage, void * context)
 {
-  dataStore(stream, storage.props(), context);
-  dataStore(stream, storage.propsOld(), context);
+  storage.storeState(stream, 0, context);
+  storage.storeState(stream, 1, context);
 
   if (storage.hasOlderProperties())
-    dataStore(stream, storage.propsOlder(), context);
+    storage.storeState(stream, 2, context);
 }
 
 template <>
 inline void
 dataLoad(std::istream & stream, MaterialPropertyStorage & storage, void * context)
 {
-  dataLoad(stream, storage.props(), context);
-  dataLoad(stream, storage.propsOld(), context);
+  storage.loadState(stream, 0, context);
+  storage.loadState(stream, 1, context);
 
   if (storage.hasOlderProperties())
-    dataLoad(stream, storage.propsOlder(), context);
+    storage.loadState(stream, 2, context);
 }
 
 #endif /* MATERIALPROPERTYSTORAGE_H */
@@ -51,6 +51,16 @@ public:
   void sort(THREAD_ID tid = 0);
   ///@}
 
+  /**
+   * Fills \p consumed with the materials, out of \p materials sorted in dependency order, that
+   * compute one of \p needed_mat_props or a property another such material depends on. Materials
+   * with stateful properties or without any declared property are always kept since their
+   * evaluation may be needed regardless.
+   */
+  static void consumedObjects(const std::vector<std::shared_ptr<Material>> & materials,
+                              std::set<unsigned int> needed_mat_props,
+                              std::vector<std::shared_ptr<Material>> & consumed);
+
   /**
    * A special method unique to this class for adding Block, Neighbor, and Face material objects.
    */
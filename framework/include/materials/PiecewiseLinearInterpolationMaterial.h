@@ -53,6 +53,9 @@ protected:
 
   /// LinearInterpolation object
   std::unique_ptr<LinearInterpolation> _linear_interp;
+
+  /// Interval found by the last table lookup, used to speed up the next one
+  unsigned int _interval_hint;
 };
 
 #endif // PIECEWISELINEARINTERPOLATIONMATERIAL_H
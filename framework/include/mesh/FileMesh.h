@@ -42,6 +42,14 @@ public:
   const std::string & getFileName() const { return _file_name; }
 
 protected:
+  /**
+   * Read an ExodusII file on processor 0 only, partition it there along a
+   * Hilbert curve through the element centroids and send every processor its
+   * own part. The other processors never hold more than their partition and
+   * its ghost layer.
+   */
+  void readOnRootAndScatter();
+
   /// the file_name from whence this mesh came
   std::string _file_name;
   /// Auxiliary object for restart
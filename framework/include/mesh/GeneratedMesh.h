@@ -40,6 +40,17 @@ public:
   virtual Real getMaxInDimension(unsigned int component) const override;
 
 protected:
+  /**
+   * Builds only the layers of elements (along the last mesh dimension) owned
+   * by this processor, plus one ghost layer on each side, directly into the
+   * DistributedMesh. Element and node ids only depend on their grid indices,
+   * so every processor agrees on them without communication.
+   */
+  void buildDistributedMesh(ElemType elem_type);
+
+  /// Coordinate of the grid plane with the given index in direction dir, including any bias
+  Real gridCoordinate(unsigned int dir, unsigned int index) const;
+
   /// The dimension of the mesh
   MooseEnum _dim;
 
@@ -62,6 +73,9 @@ protected:
   /// _bias_x==1 implies no bias (original mesh unchanged).
   /// _bias_x > 1 implies cells are growing in the x-direction.
   Real _bias_x, _bias_y, _bias_z;
+
+  /// Whether each processor only generates its own part of a DistributedMesh
+  bool _distributed_generation;
 };
 
 #endif /* GENERATEDMESH_H */
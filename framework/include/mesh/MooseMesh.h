@@ -49,6 +49,33 @@ typedef StoredRange<std::set<Node *>::iterator, Node *> SemiLocalNodeRange;
 template <>
 InputParameters validParams<MooseMesh>();
 
+/**
+ * The blocks (domains) each node belongs to. Most nodes share one of a handful of
+ * distinct block sets, so the sorted node ids only hold an index into that list
+ */
+struct NodeBlockData
+{
+  std::vector<dof_id_type> node_ids;
+  std::vector<unsigned int> set_index;
+  std::vector<std::set<SubdomainID>> sets;
+};
+
+/**
+ * Data shared by the meshes of the sub-apps on a processor that are built from the same input
+ * file, see the MultiApp 'share_mesh' parameter
+ */
+struct SharedMeshData
+{
+  /// The mesh of the first sub-app after the MeshModifiers ran, before any uniform refinement
+  std::unique_ptr<MeshBase> mesh;
+
+  /// The node block data of the first sub-app once its setup is complete
+  std::shared_ptr<const NodeBlockData> node_blocks;
+
+  /// The number of elements of the mesh the node block data belongs to
+  dof_id_type node_blocks_n_elem = 0;
+};
+
 /**
  * Helper object for holding qp mapping info.
  */
@@ -95,9 +122,39 @@ public:
    * and call build_mesh so the child class can build the Mesh object.
    *
    * However, during Recovery this will read the CPA file...
+   * and when a matching 'mesh_cache' exists the modified mesh is read from it.
    */
   virtual void init();
 
+  /**
+   * Whether the element loops visit the elements grouped by subdomain and element type
+   */
+  bool groupElementsByType() const { return _group_elements_by_type; }
+
+  /**
+   * Whether the mesh was read from the 'mesh_cache' file, in which case the
+   * MeshModifiers have already been applied to it.
+   */
+  bool loadedFromCache() const { return _loaded_from_cache; }
+
+  /**
+   * Whether the mesh was copied from a sibling sub-app built from the same input, in which
+   * case the MeshModifiers have already been applied to it.
+   */
+  bool copiedFromSharedMesh() const { return _copied_from_shared_mesh; }
+
+  /**
+   * Hand a copy of the modified mesh to the sibling sub-apps built from the same input, unless
+   * one of them already did. Does nothing for apps that do not share their mesh.
+   */
+  void storeSharedMesh();
+
+  /**
+   * Write the modified mesh to the 'mesh_cache' file together with the key
+   * of the input that produced it. Does nothing without a 'mesh_cache'.
+   */
+  void writeMeshCache();
+
   /**
    * Must be overridden by child classes.
    *
@@ -224,6 +281,13 @@ public:
   virtual dof_id_type nNodes() const;
   virtual dof_id_type nElem() const;
 
+  /**
+   * Estimate of the bytes held by the libMesh elements and nodes stored on this processor and
+   * by the maps MooseMesh builds on top of them (boundary lists, node to element maps,
+   * refinement maps, ...)
+   */
+  std::size_t memoryFootprint() const;
+
   /**
    * Calls max_node/elem_id() on the underlying libMesh mesh object.
    * This may be larger than n_nodes/elem() in cases where the id
@@ -280,6 +344,12 @@ public:
    */
   void meshChanged();
 
+  /**
+   * The number of times meshChanged() has been called.  Objects caching data
+   * derived from the mesh structure can compare against this to know when to rebuild.
+   */
+  unsigned int meshChangedCount() const { return _mesh_changed_count; }
+
   /**
   * Declares a callback function that is executed at the conclusion
   * of meshChanged(). Ther user can implement actions required after
@@ -340,6 +410,13 @@ public:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode *> * getBoundaryNodeRange();
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement *> * getBoundaryElementRange();
 
+  /**
+   * The active local elements split into colors, one range per color.  Elements of the same color
+   * share no node, so threads working on one color never touch the same degrees of freedom.
+   * Computed on first use and again after the mesh changed.
+   */
+  const std::vector<std::unique_ptr<ConstElemRange>> & getActiveLocalElementColorRanges();
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -447,6 +524,12 @@ public:
    */
   const MooseEnum & getPatchUpdateStrategy() const;
 
+  /**
+   * Get the fraction of the patch radius a slave node may drift before its patch is rebuilt by the
+   * incremental patch update strategy.
+   */
+  Real getPatchUpdateTolerance() const;
+
   /**
    * Get a (slightly inflated) processor bounding box.
    *
@@ -573,15 +656,29 @@ public:
    */
   void setBoundaryName(BoundaryID boundary_id, BoundaryName name);
 
+  /// Pairs of node ids matched across a periodic boundary, sorted and in both directions
+  typedef std::vector<std::pair<dof_id_type, dof_id_type>> PeriodicNodeMap;
+
   /**
-   * This routine builds a multimap of boundary ids to matching boundary ids across all periodic
-   * boundaries
-   * in the system.
+   * This routine builds the list of node ids matching across all periodic boundaries of the
+   * variable in the system. The nodes are matched through a spatial hash of the paired boundary
+   * nodes, and the map is reused as long as the nodes on these boundaries do not change.
    */
+  void buildPeriodicNodeMap(PeriodicNodeMap & periodic_node_map,
+                            unsigned int var_number,
+                            PeriodicBoundaries * pbs) const;
+
+  // DEPRECATED METHOD
   void buildPeriodicNodeMap(std::multimap<dof_id_type, dof_id_type> & periodic_node_map,
                             unsigned int var_number,
                             PeriodicBoundaries * pbs) const;
 
+  /**
+   * The range of \p periodic_node_map holding the nodes matched to \p node_id
+   */
+  static std::pair<PeriodicNodeMap::const_iterator, PeriodicNodeMap::const_iterator>
+  periodicNodeRange(const PeriodicNodeMap & periodic_node_map, dof_id_type node_id);
+
   /**
    * This routine builds a datastructure of node ids organized by periodic boundary ids
    */
@@ -872,6 +969,21 @@ protected:
   /// true if mesh is changed (i.e. after adaptivity step)
   bool _is_changed;
 
+  /// Incremented every time meshChanged() is called
+  unsigned int _mesh_changed_count;
+
+  /// The periodic boundary nodes a periodic node map was built from and the map itself
+  struct PeriodicNodeMapCache
+  {
+    std::vector<std::pair<boundary_id_type, dof_id_type>> boundary_nodes;
+    std::vector<Point> boundary_points;
+    PeriodicNodeMap periodic_node_map;
+  };
+
+  /// The last periodic node maps built, for each variable and set of periodic boundaries
+  mutable std::map<std::pair<unsigned int, const PeriodicBoundaries *>, PeriodicNodeMapCache>
+      _periodic_node_map_cache;
+
   /// True if a Nemesis Mesh was read in
   bool _is_nemesis;
 
@@ -899,6 +1011,10 @@ protected:
    */
   std::unique_ptr<ConstElemRange> _active_local_elem_range;
 
+  /// The active local elements of each color, see getActiveLocalElementColorRanges()
+  std::vector<std::vector<Elem *>> _active_local_elem_colors;
+  std::vector<std::unique_ptr<ConstElemRange>> _active_local_elem_color_ranges;
+
   std::unique_ptr<SemiLocalNodeRange> _active_semilocal_node_range;
   std::unique_ptr<NodeRange> _active_node_range;
   std::unique_ptr<ConstNodeRange> _local_node_range;
@@ -940,8 +1056,8 @@ protected:
   std::vector<BndNode *> _bnd_nodes;
   typedef std::vector<BndNode *>::iterator bnd_node_iterator_imp;
   typedef std::vector<BndNode *>::const_iterator const_bnd_node_iterator_imp;
-  /// Map of sets of node IDs in each boundary
-  std::map<boundary_id_type, std::set<dof_id_type>> _bnd_node_ids;
+  /// Map of sorted node IDs in each boundary
+  std::map<boundary_id_type, std::vector<dof_id_type>> _bnd_node_ids;
 
   /// array of boundary elems
   std::vector<BndElement *> _bnd_elems;
@@ -955,8 +1071,8 @@ protected:
       _elem_to_side_to_qp_to_quadrature_nodes;
   std::vector<BndNode> _extra_bnd_nodes;
 
-  /// list of nodes that belongs to a specified block (domain)
-  std::map<dof_id_type, std::set<SubdomainID>> _block_node_list;
+  /// The blocks (domains) each node belongs to, possibly shared with sibling sub-apps
+  std::shared_ptr<const NodeBlockData> _node_blocks;
 
   /// list of nodes that belongs to a specified nodeset: indexing [nodeset_id] -> [array of node ids]
   std::map<boundary_id_type, std::vector<dof_id_type>> _node_set_nodes;
@@ -970,6 +1086,9 @@ protected:
   /// The patch update strategy
   MooseEnum _patch_update_strategy;
 
+  /// The relative drift triggering a patch rebuild with the incremental patch update strategy
+  Real _patch_update_tolerance;
+
   /// file_name iff this mesh was read from a file
   std::string _file_name;
 
@@ -995,6 +1114,24 @@ protected:
   void freeBndNodes();
   void freeBndElems();
 
+  /**
+   * Renumbers the elements in the order of their centroids along the
+   * space-filling curve selected by 'element_ordering', and the nodes in the
+   * order in which those elements first reference them, so that elements
+   * and nodes close in memory (and in the DoF numbering) are close in space.
+   */
+  void reorderElementsAndNodes();
+
+  /**
+   * A key identifying the input the mesh was built from: the input file, the
+   * command line, the number of processors and (for meshes read from a file)
+   * the size and modification time of the mesh file.
+   */
+  std::string meshCacheKey() const;
+
+  /// Whether 'mesh_cache' holds a mesh written from the same input as this run
+  bool meshCacheValid();
+
 private:
   /**
    * A map of vectors indicating which dimensions are periodic in a regular orthogonal mesh for
@@ -1021,7 +1158,8 @@ private:
    * Build the refinement map for a given element type.  This will tell you what quadrature points
    * to copy from and to for stateful material properties on newly created elements from Adaptivity.
    *
-   * @param elem The element that represents the element type you need the refinement map for.
+   * @param elem The refined template element (see buildAdaptivityTemplate()) of the element type
+   * you need the refinement map for.
    * @param qrule The quadrature rule in use.
    * @param qrule_face The current face quadrature rule
    * @param parent_side The side of the parent to map (-1 if not mapping parent sides)
@@ -1039,13 +1177,25 @@ private:
    * Build the coarsening map for a given element type.  This will tell you what quadrature points
    * to copy from and to for stateful material properties on newly created elements from Adaptivity.
    *
-   * @param elem The element that represents the element type you need the coarsening map for.
+   * @param elem The refined template element (see buildAdaptivityTemplate()) of the element type
+   * you need the coarsening map for.
    * @param qrule The quadrature rule in use.
    * @param qrule_face The current face quadrature rule
    * @param input_side The side to map
    */
   void buildCoarseningMap(const Elem & elem, QBase & qrule, QBase & qrule_face, int input_side);
 
+  /**
+   * Copy an element into an otherwise empty mesh and refine it once, so that
+   * all of the refinement and coarsening maps of its type can be found on
+   * the same children.
+   *
+   * @param elem The element that represents the element type you need the maps for.
+   * @param template_mesh The empty mesh that will hold the copy and its children.
+   * @return The copy of elem, now the parent of its children in template_mesh.
+   */
+  const Elem & buildAdaptivityTemplate(const Elem & elem, ReplicatedMesh & template_mesh);
+
   /**
    * Find the closest points that map "from" to "to" and fill up "qp_map".
    * Essentially, for each point in "from" find the closest point in "to".
@@ -1071,7 +1221,8 @@ private:
    *
    * Case 3 only happens under refinement (need to invent data at internal child sides).
    *
-   * @param template_elem An element of the type that we need to find the maps for
+   * @param template_elem The refined template element (see buildAdaptivityTemplate()) of the type
+   * that we need to find the maps for
    * @param qrule The quadrature rule that we need to find the maps for
    * @param qrule_face The face quadrature rule that we need to find the maps for
    * @param refinement_map The map to use when an element gets split
@@ -1108,6 +1259,21 @@ private:
 
   /// Whether or not to allow generation of nodesets from sidesets
   bool _construct_node_list_from_side_list;
+
+  /// The space-filling curve used to renumber the elements and nodes ("none" to keep the mesh numbering)
+  const MooseEnum _element_ordering;
+
+  /// Whether the element loops visit the elements grouped by subdomain and element type
+  const bool _group_elements_by_type;
+
+  /// Whether the elements have already been renumbered along the space-filling curve
+  bool _elements_reordered;
+
+  /// Whether the mesh was read from the 'mesh_cache' file
+  bool _loaded_from_cache;
+
+  /// Whether the mesh was copied from a sibling sub-app built from the same input
+  bool _copied_from_shared_mesh;
 };
 
 /**
@@ -25,6 +25,7 @@ class FEProblem;
 class Executioner;
 class MooseApp;
 class Backup;
+struct SharedMeshData;
 
 // libMesh forward declarations
 namespace libMesh
@@ -47,6 +48,15 @@ class SubAppBackups : public std::vector<std::shared_ptr<Backup>>
 {
 };
 
+/**
+ * The Backups must be refreshed by their MultiApp when they are stored, so they can not be copied
+ * into an in-memory snapshot.
+ */
+template <>
+struct RestartableSnapshotCopyable<SubAppBackups> : std::false_type
+{
+};
+
 /**
  * A MultiApp represents one or more MOOSE applications that are running simultaneously.
  * These other MOOSE apps generally represent some "sub-solve" or "embedded-solves"
@@ -109,6 +119,12 @@ public:
    */
   virtual void backup();
 
+  /**
+   * Save off the state of every Sub App into serialized streams, as needed for checkpoints,
+   * even when in-memory backups are used
+   */
+  void streamBackup();
+
   /**
    * Restore the state of every Sub App
    *
@@ -168,7 +184,7 @@ public:
    * @param app The global app number you want to get a Postprocessor from.
    * @param name The name of the Postprocessor.
    */
-  Real appPostprocessorValue(unsigned int app, const std::string & name);
+  virtual Real appPostprocessorValue(unsigned int app, const std::string & name);
 
   /**
    * Get the vector to transfer to for this MultiApp.
@@ -381,6 +397,15 @@ protected:
   /// Whether or not this processor as an App _at all_
   bool _has_an_app;
 
+  /// Whether the Sub Apps are backed up by copying their state in memory instead of serializing it
+  const bool _in_memory_backup;
+
+  /// Whether the local Apps built from the same input file start from a copy of the same mesh
+  const bool _share_mesh;
+
+  /// The mesh data shared by the local Apps, by input file
+  std::map<std::string, std::shared_ptr<SharedMeshData>> _shared_meshes;
+
   /// Backups for each local App
   SubAppBackups & _backups;
 };
@@ -391,11 +416,11 @@ dataStore(std::ostream & stream, SubAppBackups & backups, void * context)
 {
   MultiApp * multi_app = static_cast<MultiApp *>(context);
 
-  multi_app->backup();
-
   if (!multi_app)
     mooseError("Error storing std::vector<Backup*>");
 
+  multi_app->streamBackup();
+
   for (unsigned int i = 0; i < backups.size(); i++)
     dataStore(stream, backups[i], context);
 }
@@ -49,7 +49,7 @@ public:
   /**
    * Finds the smallest dt from among any of the apps.
    */
-  Real computeDT();
+  virtual Real computeDT();
 
 private:
   /**
@@ -105,6 +105,36 @@ public:
    */
   virtual void computeOffDiagJacobian(unsigned int jvar);
 
+  /**
+   * Whether the residual only depends on the value and time derivative of the variable at the
+   * node, in which case block restricted kernels are computed through computeBlockResidual() on
+   * blocks of nodes, without reinitializing each node. Classes deriving from a kernel returning
+   * true and changing its residual must override both.
+   */
+  virtual bool hasBlockResidual() const { return false; }
+
+  /**
+   * Compute the residual at a block of nodes at once.
+   * @param nodes The nodes of the block
+   * @param u The values of the variable at the nodes
+   * @param u_dot The time derivatives of the variable at the nodes
+   * @param residual The residuals at the nodes, to be filled
+   */
+  virtual void computeBlockResidual(const std::vector<const Node *> & nodes,
+                                    const std::vector<Real> & u,
+                                    const std::vector<Real> & u_dot,
+                                    std::vector<Real> & residual);
+
+  /**
+   * The residual the contributions of this kernel are added to
+   */
+  virtual Moose::KernelType residualType() const { return Moose::KT_NONTIME; }
+
+  /**
+   * The auxiliary variables the residual contributions are saved to
+   */
+  const std::vector<MooseVariable *> & saveInVariables() const { return _save_in; }
+
 protected:
   /**
    * The user can override this function to compute the residual at a node.
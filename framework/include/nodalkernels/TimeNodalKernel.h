@@ -35,6 +35,8 @@ public:
    */
   TimeNodalKernel(const InputParameters & parameters);
 
+  virtual Moose::KernelType residualType() const override { return Moose::KT_TIME; }
+
 protected:
   virtual void computeResidual() override;
 };
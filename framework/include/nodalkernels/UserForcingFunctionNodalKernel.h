@@ -35,6 +35,12 @@ public:
    */
   UserForcingFunctionNodalKernel(const InputParameters & parameters);
 
+  virtual bool hasBlockResidual() const override { return true; }
+  virtual void computeBlockResidual(const std::vector<const Node *> & nodes,
+                                    const std::vector<Real> & u,
+                                    const std::vector<Real> & u_dot,
+                                    std::vector<Real> & residual) override;
+
 protected:
   virtual Real computeQpResidual() override;
 
@@ -101,6 +101,14 @@ public:
    */
   const std::set<std::string> & getElementalVariableOutput();
 
+  /**
+   * Whether a call to outputStep() with the given type would write a nodal or elemental variable
+   * at the current step
+   * @param var_name The name of the variable
+   * @param type The execution flag of the output
+   */
+  bool willOutputVariable(const std::string & var_name, const ExecFlagType & type);
+
   /**
    * Returns true if there exists scalar variables for output
    * @return True if scalar variable output exists
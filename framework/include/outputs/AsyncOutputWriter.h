@@ -0,0 +1,84 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef ASYNCOUTPUTWRITER_H
+#define ASYNCOUTPUTWRITER_H
+
+// C++ includes
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * A dedicated thread that runs output write tasks in the order they were queued, so the
+ * simulation can continue while the data is written to disk.
+ *
+ * Tasks must only use data they own (i.e. a snapshot of what is being written); they must not
+ * touch the mesh, the systems or communicate.
+ */
+class AsyncOutputWriter
+{
+public:
+  /**
+   * @param max_queue_size The number of tasks that may be waiting; push() blocks while the queue is
+   * full.
+   */
+  AsyncOutputWriter(unsigned int max_queue_size);
+
+  /// Completes the queued tasks and stops the thread
+  ~AsyncOutputWriter();
+
+  /**
+   * Queue a write task.  Blocks while the queue is full.
+   */
+  void push(std::function<void()> task);
+
+  /**
+   * Block until all the queued tasks are done.  Errors raised by the tasks are reported here.
+   */
+  void flush();
+
+private:
+  /// The loop run by the writer thread
+  void run();
+
+  const unsigned int _max_queue_size;
+
+  std::deque<std::function<void()>> _queue;
+
+  /// Whether the writer thread is running a task
+  bool _busy;
+
+  /// Set to stop the writer thread
+  bool _stop;
+
+  /// Error message of a failed task
+  std::string _error;
+
+  std::mutex _mutex;
+
+  /// Signaled when work is queued or the thread is stopped
+  std::condition_variable _work_available;
+
+  /// Signaled when a task has been taken from the queue or completed
+  std::condition_variable _work_done;
+
+  std::thread _thread;
+};
+
+#endif // ASYNCOUTPUTWRITER_H
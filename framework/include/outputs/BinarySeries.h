@@ -0,0 +1,104 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BINARYSERIES_H
+#define BINARYSERIES_H
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+
+// Forward declarations
+class BinarySeries;
+
+template <>
+InputParameters validParams<BinarySeries>();
+
+/**
+ * Appends the postprocessor and VectorPostprocessor values of each output to binary files, so the
+ * cost of an output does not grow with the number of outputs already written.
+ *
+ * The postprocessors are written to <file_base>.bin and each VectorPostprocessor to
+ * <file_base>_<name>.bin (with the .<n_procs>.<proc_id> suffix for the distributed ones). A file
+ * is a sequence of records in the native byte order, each starting with a one character tag:
+ *   'N': uint32 count followed by count null terminated column names, this record is written
+ *        before the first data record and whenever the columns change
+ *   'D': double time and int32 time step followed, for each column, by a double for the
+ *        postprocessors or by an uint64 length and length doubles for the VectorPostprocessors
+ */
+class BinarySeries : public AdvancedOutput
+{
+public:
+  /**
+   * Class constructor
+   */
+  BinarySeries(const InputParameters & parameters);
+
+  /**
+   * Class destructor, writes the buffered outputs
+   */
+  virtual ~BinarySeries();
+
+  /**
+   * The name of the postprocessor file
+   */
+  virtual std::string filename() override;
+
+protected:
+  /**
+   * Appends the values of the current output to the buffers and writes the buffers when full
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+  /**
+   * Appends a record of the postprocessor values to the buffer of the postprocessor file
+   */
+  virtual void outputPostprocessors() override;
+
+  /**
+   * Appends a record of the vectors to the buffer of the file of each VectorPostprocessor
+   */
+  virtual void outputVectorPostprocessors() override;
+
+private:
+  /**
+   * Starts a data record in the buffer of a file, preceded by the column names if they changed
+   * @return The buffer of the file
+   */
+  std::string & startRecord(const std::string & file_name, const std::vector<std::string> & names);
+
+  /**
+   * Appends the buffers to the files
+   */
+  void flush();
+
+  /// The number of outputs held in the buffers before they are written
+  const unsigned int _buffer_steps;
+
+  /// The number of outputs currently held in the buffers
+  unsigned int & _buffered_steps;
+
+  /// The data not yet written to each file
+  std::map<std::string, std::string> & _buffers;
+
+  /// The number of bytes written to each file, used for dropping outputs made after the checkpoint
+  std::map<std::string, unsigned long long> & _file_sizes;
+
+  /// The last column names written to each file
+  std::map<std::string, std::vector<std::string>> & _columns;
+
+  /// The files written by this run
+  std::set<std::string> _opened_files;
+};
+
+#endif // BINARYSERIES_H
@@ -76,6 +76,12 @@ protected:
   virtual void outputVectorPostprocessors() override;
 
 private:
+  /**
+   * Write a table to a *.csv file, directly or through the asynchronous writer thread
+   * @param formatted Whether the delimiter, precision and alignment options apply to this table
+   */
+  void writeTable(FormattedTable & table, const std::string & file_name, bool formatted);
+
   /// Flag for aligning data in .csv file
   bool _align;
 
@@ -94,6 +100,15 @@ private:
 
   /// Flag for sorting column names
   const bool _sort_columns;
+
+  /// Whether the files are written by the asynchronous writer thread
+  const bool _asynchronous;
+
+  /// Flag for appending the new rows instead of rewriting the files
+  const bool _append_only;
+
+  /// The number of rows kept in memory when appending
+  const unsigned int _tail_rows;
 };
 
 #endif /* CSV_H */
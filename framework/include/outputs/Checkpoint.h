@@ -73,9 +73,27 @@ protected:
    */
   virtual void output(const ExecFlagType & type) override;
 
+  /**
+   * Marks the mesh as changed so that the next checkpoint writes it again
+   */
+  virtual void meshChanged() override;
+
 private:
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * The mesh files written by CheckpointIO for the given checkpoint file name and owned by this
+   * processor.
+   */
+  std::vector<std::string> meshFileNames(const std::string & checkpoint) const;
+
+  /**
+   * Creates hard links to the mesh files of the checkpoint 'from' under the names of the
+   * checkpoint 'to'.
+   * @return True if all links owned by this processor were created
+   */
+  bool linkMeshFiles(const std::string & from, const std::string & to) const;
+
   /// Max no. of output files to store
   unsigned int _num_files;
 
@@ -85,6 +103,27 @@ private:
   /// True if outputing checkpoint files in binary format
   bool _binary;
 
+  /// True if the restartable data of all processors goes into a single file
+  bool _shared_restart_file;
+
+  /// True if the shared restartable data file is written in the background
+  bool _async_restart_write;
+
+  /// True if the mesh files of the previous checkpoint are linked while the mesh is unchanged
+  bool _reuse_unchanged_mesh;
+
+  /// Number of checkpoints after which the mesh is written even if it did not change
+  unsigned int _full_checkpoint_interval;
+
+  /// True if the mesh changed since it was last written
+  bool _mesh_changed;
+
+  /// Number of checkpoints since the mesh was last written
+  unsigned int _checkpoints_since_mesh_write;
+
+  /// The checkpoint file name the mesh was last written to
+  std::string _last_mesh_file;
+
   /// True if running with parallel mesh
   bool _parallel_mesh;
 
@@ -59,6 +59,12 @@ public:
    */
   virtual void output(const ExecFlagType & type) override;
 
+  /**
+   * Writes the binary log, which is done for every step regardless of the 'interval', before
+   * performing the formatted output
+   */
+  virtual void outputStep(const ExecFlagType & type) override;
+
   /**
    * Creates the output file name
    * Appends the user-supplied 'file_base' input parameter with a '.txt' extension
@@ -121,6 +127,11 @@ protected:
    */
   virtual void outputSystemInformation() override;
 
+  /**
+   * Print the estimated memory of each subsystem, see FEProblemBase::memoryReport()
+   */
+  void outputMemoryReport();
+
   /**
    * A helper function for outputting norms in color
    * @param old_norm The old residual norm to compare against
@@ -128,6 +139,12 @@ protected:
    */
   std::string outputNorm(const Real & old_norm, const Real & norm);
 
+  /**
+   * Appends the raw values of the current step (residual norms, time step information and
+   * postprocessor values) to the binary log, see the 'binary_log' parameter for the format
+   */
+  void writeBinaryLog(const ExecFlagType & type);
+
   /**
    * Prints the time step information for the screen output
    */
@@ -197,6 +214,18 @@ protected:
   /// State for the performance log header information
   bool _perf_header;
 
+  /// State for printing the graph of timed sections
+  bool _perf_graph;
+
+  /// File the graph of timed sections is written to as JSON (empty for none)
+  const FileName _perf_graph_json;
+
+  /// State for timing each object and printing the accumulated times
+  const bool _object_timing;
+
+  /// State for sampling the hardware counters of the element loops and printing them
+  const bool _hardware_counters;
+
   /// Flag for writing all variable norms
   bool _all_variable_norms;
 
@@ -240,6 +269,18 @@ private:
   /// Flags for controlling the what simulations information is shown
   MultiMooseEnum _system_info_flags;
 
+  /// When to print the estimated memory of each subsystem
+  const MultiMooseEnum _memory_report;
+
+  /// The name of the binary log (empty for none)
+  const FileName _binary_log_file;
+
+  /// The binary log stream
+  std::ofstream _binary_log;
+
+  /// The postprocessor names last written to the binary log
+  std::vector<std::string> _binary_log_names;
+
   friend class OutputWarehouse;
 
 private:
@@ -0,0 +1,116 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef INSITU_H
+#define INSITU_H
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+#include "InSituPipeline.h"
+
+// Forward declarations
+class InSitu;
+
+// libMesh forward declarations
+namespace libMesh
+{
+class DofObject;
+}
+
+template <>
+InputParameters validParams<InSitu>();
+
+/**
+ * Hands the local mesh and solution to an in-situ pipeline loaded from a shared library at each
+ * output step, see InSituPipeline.h for the interface of the pipeline.
+ */
+class InSitu : public AdvancedOutput
+{
+public:
+  /**
+   * Class constructor
+   */
+  InSitu(const InputParameters & parameters);
+
+  /**
+   * Class destructor, finalizes the pipeline
+   */
+  virtual ~InSitu();
+
+  /**
+   * Loads and initializes the pipeline
+   */
+  virtual void initialSetup() override;
+
+  /**
+   * Flags the local mesh data for rebuilding
+   */
+  virtual void meshChanged() override;
+
+protected:
+  /**
+   * Fills the field values and executes the pipeline
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+  /**
+   * Builds the local nodes, elements and the dof indices of the fields
+   */
+  void buildMeshData();
+
+  /**
+   * Adds a variable field holding the values at the given local nodes or elements
+   * @param name The name of the variable
+   * @param centering The centering of the field, see MooseInSituField
+   * @param objects The local nodes or elements
+   */
+  void addVariableField(const std::string & name,
+                        int centering,
+                        const std::vector<const DofObject *> & objects);
+
+  /// The shared library holding the pipeline
+  void * _handle;
+
+  /// The pipeline functions
+  MooseInSituExecute _execute;
+  MooseInSituFinalize _finalize;
+
+  /// Flag for rebuilding the local mesh data
+  bool _mesh_changed;
+
+  ///@{
+  /// The local mesh data, these are kept between the output steps so only the values are updated
+  std::vector<unsigned long> _node_ids;
+  std::vector<double> _coordinates;
+  std::vector<unsigned long> _elem_ids;
+  std::vector<int> _elem_types;
+  std::vector<unsigned long> _offsets;
+  std::vector<unsigned long> _connectivity;
+  ///@}
+
+  /// The names and centerings of the variable fields
+  std::vector<std::string> _field_names;
+  std::vector<int> _field_centerings;
+
+  /// The fields handed to the pipeline
+  std::vector<MooseInSituField> _fields;
+
+  /// The values of each field
+  std::vector<std::vector<double>> _field_values;
+
+  /// The system number and dof indices of each variable field (invalid ids are missing values)
+  std::vector<std::pair<unsigned int, std::vector<dof_id_type>>> _field_dofs;
+};
+
+#endif // INSITU_H
@@ -0,0 +1,89 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef INSITUPIPELINE_H
+#define INSITUPIPELINE_H
+
+/**
+ * The C interface between the InSitu output and an in-situ visualization or data reduction
+ * pipeline (e.g. a Catalyst or ADIOS2 adaptor). The pipeline is a shared library providing the
+ * three functions declared at the end of this file; it only needs this header to be built.
+ *
+ * All of the arrays handed to the pipeline are owned by MOOSE and are only valid during the call
+ * to moose_insitu_execute(), they must be copied if the pipeline needs them afterwards.
+ */
+extern "C" {
+
+/// A field (variable or postprocessor) of the current output step
+struct MooseInSituField
+{
+  /// The name of the variable or postprocessor
+  const char * name;
+
+  /// 0 for nodal values, 1 for elemental values and 2 for a single global value
+  int centering;
+
+  /// The values, one per local node, local element or a single value for global fields
+  const double * values;
+};
+
+/// The local part of the mesh and solution handed to the pipeline at every output step
+struct MooseInSituStep
+{
+  /// The simulation time and time step
+  double time;
+  int time_step;
+
+  /// Non-zero if the mesh differs from the one of the previous call
+  int mesh_changed;
+
+  /// The nodes of the local elements: global ids and coordinates (x, y, z for each node)
+  unsigned long n_nodes;
+  const unsigned long * node_ids;
+  const double * coordinates;
+
+  /// The local elements: global ids, libMesh element types and the connectivity (indices into the
+  /// local nodes) of element i from connectivity[offsets[i]] to connectivity[offsets[i + 1]]
+  unsigned long n_elems;
+  const unsigned long * elem_ids;
+  const int * elem_types;
+  const unsigned long * offsets;
+  const unsigned long * connectivity;
+
+  /// The fields
+  unsigned long n_fields;
+  const MooseInSituField * fields;
+};
+
+/**
+ * Called once before the first output step
+ * @param script The script (or configuration file) given by the 'script' parameter
+ * @param communicator A pointer to the MPI communicator of the simulation (MPI_Comm *)
+ * @return zero on success
+ */
+typedef int (*MooseInSituInitialize)(const char * script, void * communicator);
+
+/**
+ * Called at every output step
+ * @return zero on success
+ */
+typedef int (*MooseInSituExecute)(const MooseInSituStep * step);
+
+/**
+ * Called once when the output is destroyed
+ */
+typedef void (*MooseInSituFinalize)();
+}
+
+#endif // INSITUPIPELINE_H
@@ -0,0 +1,59 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef JACOBIANSPARSITYOUTPUT_H
+#define JACOBIANSPARSITYOUTPUT_H
+
+// MOOSE includes
+#include "Output.h"
+
+// Forward declarations
+class JacobianSparsityOutput;
+
+template <>
+InputParameters validParams<JacobianSparsityOutput>();
+
+/**
+ * Reports the statistics of the assembled Jacobian that dictate the cost of the solve: the
+ * nonzeros per row of every variable pair, which coupling blocks are allocated and actually
+ * filled, the ratio of ghosted to local DOFs and the memory of the matrix.
+ *
+ * A coupling block that is allocated but never receives a nonzero value (e.g. because of
+ * SMP full = true without matching off-diagonal Jacobians) only costs memory and solve time, so
+ * a warning is produced for it.
+ */
+class JacobianSparsityOutput : public Output
+{
+public:
+  JacobianSparsityOutput(const InputParameters & parameters);
+
+protected:
+  /**
+   * Print the report, if the number of nonzeros changed since the last one
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+  /**
+   * Map a DOF to its variable for the local and ghosted DOFs
+   * @param local_vars The variable of every local DOF (filled by this method)
+   * @param ghost_vars The variable of every ghosted DOF (filled by this method)
+   */
+  void mapDofsToVariables(std::vector<unsigned int> & local_vars,
+                          std::map<dof_id_type, unsigned int> & ghost_vars);
+
+  /// The number of allocated nonzeros at the last report
+  Real _last_nonzeros;
+};
+
+#endif /* JACOBIANSPARSITYOUTPUT_H */
@@ -80,6 +80,13 @@ protected:
    */
   virtual std::string filename() override;
 
+  /**
+   * Joins the per processor files of a Nemesis output into a single ExodusII file by calling
+   * the merge command (SEACAS epu), the per processor files are removed on success
+   * @param file_name The base name of the Nemesis output (as returned by filename())
+   */
+  void mergeFiles(const std::string & file_name);
+
   /// Pointer to the libMesh::NemesisII_IO object that performs the actual data output
   std::unique_ptr<Nemesis_IO> _nemesis_io_ptr;
 
@@ -98,6 +105,15 @@ private:
 
   /// Flag if the output has been initialized
   bool _nemesis_initialized;
+
+  /// Flag for merging the per processor files when the output is destroyed
+  const bool _merge_files;
+
+  /// The command used for merging the files
+  const std::string _merge_command;
+
+  /// The names of the files that have been written, these are the files to be merged
+  std::vector<std::string> _written_files;
 };
 
 #endif /* NEMESIS_H */
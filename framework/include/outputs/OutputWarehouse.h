@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "Output.h"
+#include "AsyncOutputWriter.h"
 
 // Forward declarations
 class FEProblemBase;
@@ -66,6 +67,12 @@ public:
    */
   bool hasOutput(const std::string & name) const;
 
+  /**
+   * Whether any output writes the nodal or elemental variable when it is called with the given
+   * execution flag at the current step
+   */
+  bool willOutputVariable(const std::string & var_name, const ExecFlagType & type);
+
   /**
    * Calls the meshChanged method for every output object
    */
@@ -197,6 +204,16 @@ public:
   /// Returns a Boolean indicating whether performance logging is requested in this application
   bool getLoggingRequested() const { return _logging_requested; }
 
+  /**
+   * The thread used by outputs writing asynchronously, it is created on first use
+   */
+  AsyncOutputWriter & asyncWriter();
+
+  /**
+   * Wait until everything queued for asynchronous writing is on disk
+   */
+  void flushAsyncOutput();
+
 private:
   /**
    * Calls the outputStep method for each output object
@@ -350,6 +367,9 @@ private:
   /// Indicates that performance logging has been requested by the console or some object (PerformanceData)
   bool _logging_requested;
 
+  /// Thread writing the asynchronous outputs
+  std::unique_ptr<AsyncOutputWriter> _async_writer;
+
   // Allow complete access:
   // FEProblemBase for calling initial, timestepSetup, outputStep, etc. methods
   friend class FEProblemBase;
@@ -22,13 +22,6 @@
 class OversampleOutput;
 class MooseMesh;
 
-// libMesh forward declarations
-namespace libMesh
-{
-template <typename T>
-class NumericVector;
-class MeshFunction;
-}
 
 template <>
 InputParameters validParams<OversampleOutput>();
@@ -112,11 +105,33 @@ private:
   void cloneMesh();
 
   /**
-   * A vector of pointers to the mesh functions
-   * This is only populated when the oversample() function is called, it must
-   * be cleaned up by the destructor.
+   * Builds the interpolation from the solution of each system to the oversampled solution. The
+   * interpolation only depends on the meshes, so it is reused until the mesh changes.
+   */
+  void buildInterpolation();
+
+  /**
+   * The sparse interpolation operator (in compressed row storage) from the solution of a system
+   * to the oversampled solution
    */
-  std::vector<std::vector<std::unique_ptr<MeshFunction>>> _mesh_functions;
+  struct Interpolation
+  {
+    /// The oversampled dof of each row
+    std::vector<dof_id_type> dest_dofs;
+
+    /// The start of each row in columns and weights, with one entry more than there are rows
+    std::vector<unsigned int> offsets;
+
+    /// The entries of each row: positions in source_dofs and the weights
+    std::vector<unsigned int> columns;
+    std::vector<Real> weights;
+
+    /// The solution dofs needed by the local rows, only these values are gathered
+    std::vector<numeric_index_type> source_dofs;
+  };
+
+  /// The interpolation of each system
+  std::vector<Interpolation> _interpolations;
 
   /// When oversampling, the output is shift by this amount
   Point _position;
@@ -127,13 +142,8 @@ private:
   std::unique_ptr<EquationSystems> _oversample_es;
   std::unique_ptr<MooseMesh> _cloned_mesh_ptr;
 
-  /// Oversample solution vector
-  /* Each of the MeshFunctions keeps a reference to this vector, the vector is updated for the
-   * current system
-   * and variable before the MeshFunction is applied. This allows for the same MeshFunction object
-   * to be
-   * re-used, unless the mesh has changed due to adaptivity */
-  std::unique_ptr<NumericVector<Number>> _serialized_solution;
+  /// Storage for the values of the source dofs of the system being interpolated
+  std::vector<Number> _source_values;
 };
 
 #endif // OVERSAMPLEOUTPUT_H
@@ -0,0 +1,86 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PERFTRACE_H
+#define PERFTRACE_H
+
+// MOOSE includes
+#include "FileOutput.h"
+
+// Forward declarations
+class PerfTrace;
+
+template <>
+InputParameters validParams<PerfTrace>();
+
+/**
+ * Writes a timeline of the run on every processor in the Chrome trace event format, which can
+ * be opened with chrome://tracing or ui.perfetto.dev.
+ *
+ * The timeline holds the sections of the PerfGraph (time steps, Picard iterations, residual
+ * and Jacobian evaluations, user objects, transfers, MultiApps, output, ...) and the Newton
+ * iterations and linear solves seen by the PETSc monitors together with the residual norms.
+ * The events are recorded by each processor and gathered when the file is written at the end
+ * of the run (when the output is destroyed), one process of the trace per processor.  In a
+ * MultiApp only the main application writes the file; a PerfTrace in a sub-application adds the
+ * solver events of that application.
+ */
+class PerfTrace : public FileOutput
+{
+public:
+  PerfTrace(const InputParameters & parameters);
+
+  virtual ~PerfTrace();
+
+  /**
+   * The output file name, the file base with a '.json' extension ('.<processor>.json' when
+   * every processor writes its own file)
+   */
+  virtual std::string filename() override;
+
+protected:
+  /// Records the solver events on linear and nonlinear iterations
+  virtual void output(const ExecFlagType & type) override;
+
+  /// Close the running Newton iteration and linear solve spans
+  void endSolverSpans();
+
+  /// Gather the events and write the file
+  void writeTrace();
+
+  /// Whether this output writes the file (only in the main application)
+  const bool _write;
+
+  /// Whether every processor writes its own file instead of gathering the events
+  const bool _per_processor_files;
+
+  ///@{
+  /// The timeline entries of the solver events
+  const PerfGraph::PerfID _newton_id;
+  const PerfGraph::PerfID _linear_id;
+  const PerfGraph::PerfID _nonlinear_norm_id;
+  const PerfGraph::PerfID _linear_norm_id;
+  ///@}
+
+  ///@{
+  /// The running Newton iteration and linear solve (start < 0 when none is running)
+  double _newton_start;
+  int _newton_iteration;
+  double _linear_start;
+  double _linear_end;
+  int _linear_iterations;
+  ///@}
+};
+
+#endif // PERFTRACE_H
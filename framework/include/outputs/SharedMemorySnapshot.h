@@ -0,0 +1,52 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SHAREDMEMORYSNAPSHOT_H
+#define SHAREDMEMORYSNAPSHOT_H
+
+// MOOSE includes
+#include "Output.h"
+
+// Forward declarations
+class SharedMemorySnapshot;
+
+template <>
+InputParameters validParams<SharedMemorySnapshot>();
+
+/**
+ * Writes the solution and restartable data of the simulation into POSIX shared memory, one
+ * segment per processor, which outlives the application.  A following run in the same allocation
+ * restarts from it with the "restart_snapshot" parameter of the Problem block instead of reading
+ * a checkpoint from disk.
+ */
+class SharedMemorySnapshot : public Output
+{
+public:
+  /**
+   * Class constructor
+   */
+  SharedMemorySnapshot(const InputParameters & parameters);
+
+protected:
+  /**
+   * Copy the current state into the shared memory segments
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+private:
+  /// Name of the snapshot, the segments are named "/<name>.<n_procs>.<proc_id>"
+  const std::string & _snapshot_name;
+};
+
+#endif /* SHAREDMEMORYSNAPSHOT_H */
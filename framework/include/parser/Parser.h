@@ -24,6 +24,9 @@
 // libMesh include
 #include "libmesh/getpot.h"
 
+// C++ includes
+#include <unordered_set>
+
 // Forward declarations
 class ActionWarehouse;
 class SyntaxTree;
@@ -152,6 +155,22 @@ protected:
                      const std::string & action,
                      const std::string & task) const;
 
+  /**
+   * Returns a GetPot object holding the parsed contents of the passed file. The parsed tree is
+   * cached per process keyed by a hash of the file contents so that the many MultiApp sub-apps
+   * reading the same input file only tokenize it once.
+   */
+  static GetPot parsedInputFile(const std::string & input_filename);
+
+  /**
+   * Returns true when the passed fully qualified name was supplied in the input file (or absorbed
+   * from the command line). GetPot searches its variables linearly, this lookup is constant time.
+   */
+  bool haveInputVariable(const std::string & full_name) const
+  {
+    return _input_variables.count(full_name);
+  }
+
   /**
    * Helper functions for setting parameters of arbitrary types - bodies are in the .C file
    * since they are called only from this Object
@@ -241,6 +260,9 @@ protected:
   /// The getpot object used for testing
   GetPot _getpot_file_error_checking;
 
+  /// The names of all variables held by _getpot_file for fast existence checks
+  std::unordered_set<std::string> _input_variables;
+
   /// The input file name that is used for parameter extraction
   std::string _input_filename;
 
@@ -17,6 +17,8 @@
 
 #include "ElementPostprocessor.h"
 
+#include <unordered_map>
+
 // Forward Declarations
 class ElementIntegralPostprocessor;
 
@@ -28,6 +30,9 @@ InputParameters validParams<ElementIntegralPostprocessor>();
  *
  * Note that specializations of this integral are possible by deriving from this
  * class and overriding computeQpIntegral().
+ *
+ * With "incremental" enabled the contribution of each element is cached and only
+ * recomputed when the coupled degrees of freedom or the element volume change.
  */
 class ElementIntegralPostprocessor : public ElementPostprocessor
 {
@@ -46,6 +51,32 @@ protected:
   unsigned int _qp;
 
   Real _integral_value;
+
+  /// Whether element contributions are reused while their coupled DOFs do not change
+  const bool _incremental;
+
+  /// The largest change of a coupled DOF value for which a cached contribution is reused
+  const Real _incremental_tolerance;
+
+private:
+  /// The contribution of an element and the data it was computed from
+  struct CachedElementIntegral
+  {
+    std::vector<dof_id_type> dof_indices;
+    std::vector<Number> dof_values;
+    Real volume = -1;
+    Real integral = 0;
+  };
+
+  /// Gathers the coupled DOFs of the current element into _elem_dof_indices/_elem_dof_values
+  void gatherElementDofs();
+
+  /// Cached contributions, indexed by element id
+  std::unordered_map<dof_id_type, CachedElementIntegral> _cached_integrals;
+
+  /// Scratch storage for the coupled DOFs of the current element
+  std::vector<dof_id_type> _elem_dof_indices;
+  std::vector<Number> _elem_dof_values;
 };
 
 #endif
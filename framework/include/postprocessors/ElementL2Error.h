@@ -33,9 +33,15 @@ public:
   virtual Real getValue() override;
 
 protected:
+  /// Evaluates the function at all quadrature points of the element before integrating
+  virtual Real computeIntegral() override;
+
   virtual Real computeQpIntegral() override;
 
   Function & _func;
+
+  /// The function values at the quadrature points of the current element
+  std::vector<Real> _func_values;
 };
 
 #endif // ELEMENTL2ERROR_H
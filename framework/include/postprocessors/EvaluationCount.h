@@ -0,0 +1,57 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EVALUATIONCOUNT_H
+#define EVALUATIONCOUNT_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class EvaluationCount;
+
+template <>
+InputParameters validParams<EvaluationCount>();
+
+/**
+ * Reports one of the evaluation counters of the problem (e.g. "material evaluations (element)"),
+ * see EvaluationCounters.
+ */
+class EvaluationCount : public GeneralPostprocessor
+{
+public:
+  EvaluationCount(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The name of the counter
+  const std::string _counter;
+
+  /// Whether to report the count since the previous execution instead of the total
+  const bool _increment;
+
+  /// The total count at the previous execution
+  Real _previous;
+
+  /// The total count of this processor
+  Real _count;
+
+  /// The reported value
+  Real _value;
+};
+
+#endif // EVALUATIONCOUNT_H
@@ -0,0 +1,66 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef HARDWARECOUNTERDATA_H
+#define HARDWARECOUNTERDATA_H
+
+#include "GeneralPostprocessor.h"
+#include "HardwareCounters.h"
+
+// Forward Declarations
+class HardwareCounterData;
+
+template <>
+InputParameters validParams<HardwareCounterData>();
+
+/**
+ * Reports a hardware counter, or the instructions per cycle or the cache miss rate, of a
+ * threaded element loop on a subdomain, see HardwareCounters.
+ */
+class HardwareCounterData : public GeneralPostprocessor
+{
+public:
+  HardwareCounterData(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The class name of the loop, empty for all loops
+  const std::string _loop;
+
+  /// The subdomain, Moose::ANY_BLOCK_ID for all subdomains
+  const SubdomainID _subdomain;
+
+  /// The order of the first entries matches HardwareCounters::Event
+  enum class Column
+  {
+    cycles,
+    instructions,
+    cache_references,
+    cache_misses,
+    samples,
+    instructions_per_cycle,
+    cache_miss_rate
+  } _column;
+
+  /// The counted events (the last entry is the number of samples) of this processor
+  std::vector<Real> _values;
+
+  Real _value;
+};
+
+#endif // HARDWARECOUNTERDATA_H
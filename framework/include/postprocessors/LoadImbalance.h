@@ -0,0 +1,52 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef LOADIMBALANCE_H
+#define LOADIMBALANCE_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class LoadImbalance;
+
+template <>
+InputParameters validParams<LoadImbalance>();
+
+/**
+ * The ratio of the largest entry of a vector to its mean, e.g. of a per-processor vector of
+ * ProcessorLoadData, to decide whether the mesh should be repartitioned.
+ */
+class LoadImbalance : public GeneralPostprocessor
+{
+public:
+  LoadImbalance(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The vector of per-processor values
+  const VectorPostprocessorValue & _vpp_values;
+
+  /// Whether the imbalance of the change since the previous evaluation is reported
+  const bool _incremental;
+
+  /// The values at the previous evaluation
+  VectorPostprocessorValue & _previous_values;
+
+  Real _imbalance;
+};
+
+#endif // LOADIMBALANCE_H
@@ -0,0 +1,40 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NUMJACOBIANEVALUATIONS_H
+#define NUMJACOBIANEVALUATIONS_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class NumJacobianEvaluations;
+
+template <>
+InputParameters validParams<NumJacobianEvaluations>();
+
+/**
+ * Just returns the total number of Jacobian Evaluations performed.
+ */
+class NumJacobianEvaluations : public GeneralPostprocessor
+{
+public:
+  NumJacobianEvaluations(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+};
+
+#endif // NUMJACOBIANEVALUATIONS_H
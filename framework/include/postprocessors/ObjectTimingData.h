@@ -0,0 +1,69 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTTIMINGDATA_H
+#define OBJECTTIMINGDATA_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class ObjectTimingData;
+
+template <>
+InputParameters validParams<ObjectTimingData>();
+
+/**
+ * Reports the time spent in the computeResidual(), computeJacobian(), computeQpProperties() or
+ * execute() methods of an object, see ObjectTiming.
+ */
+class ObjectTimingData : public GeneralPostprocessor
+{
+public:
+  ObjectTimingData(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The name the object is timed under
+  const std::string _object;
+
+  /// The timed method, NUM_METHODS for the sum of all methods
+  const unsigned int _method;
+
+  enum class Column
+  {
+    n_calls,
+    total_time,
+    average_time
+  } _column;
+
+  enum class ValueType
+  {
+    total,
+    max_process
+  } _value_type;
+
+  ///@{
+  /// The calls and time (seconds) of this processor
+  Real _calls;
+  Real _time;
+  ///@}
+
+  Real _value;
+};
+
+#endif // OBJECTTIMINGDATA_H
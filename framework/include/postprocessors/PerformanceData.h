@@ -48,6 +48,9 @@ public:
   };
 
 protected:
+  /// The value of a section timed through the performance graph
+  Real getGraphValue(Real total_time) const;
+
   PerfLogCols _column;
 
   MooseEnum _category;
@@ -0,0 +1,52 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef STABLEEXPLICITTIMESTEP_H
+#define STABLEEXPLICITTIMESTEP_H
+
+#include "ElementPostprocessor.h"
+
+// Forward Declarations
+class StableExplicitTimeStep;
+
+template <>
+InputParameters validParams<StableExplicitTimeStep>();
+
+/**
+ * This postprocessor estimates the largest stable time step of an explicit time integrator from
+ * the smallest element size: dt = courant_number * h_min / wave_speed. Use it with PostprocessorDT.
+ */
+class StableExplicitTimeStep : public ElementPostprocessor
+{
+public:
+  StableExplicitTimeStep(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  /// Fastest signal speed of the problem
+  const Real _wave_speed;
+
+  /// Safety factor applied to the element crossing time
+  const Real _courant_number;
+
+  /// Smallest element size seen so far
+  Real _h_min;
+};
+
+#endif // STABLEEXPLICITTIMESTEP_H
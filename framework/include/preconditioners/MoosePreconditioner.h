@@ -54,7 +54,19 @@ public:
                             const unsigned int to_var,
                             NumericVector<Number> & to_vector);
 
+  /**
+   * Add the parameters controlling the automatic rigid body mode near nullspace.
+   */
+  static void addRigidBodyModeParams(InputParameters & params);
+
 protected:
+  /**
+   * Hand the rigid body modes of the displacement variables to the solver as the near
+   * nullspace (used by AMG preconditioners). The displacements are either given explicitly
+   * or detected from the conventional disp_x, disp_y and disp_z names.
+   */
+  void setupRigidBodyModes();
+
   /// Subproblem this preconditioner is part of
   FEProblemBase & _fe_problem;
 };
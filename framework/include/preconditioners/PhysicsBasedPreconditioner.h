@@ -98,6 +98,35 @@ protected:
    * to keep looking this thing up through it's name.
    */
   std::vector<std::vector<SparseMatrix<Number> *>> _off_diag_mats;
+
+  /// Number of setups between recomputing the blocks
+  const unsigned int _setup_lag;
+  /// Whether the blocks are recomputed on the first setup of every time step
+  const bool _reset_setup_lag_on_timestep;
+
+  ///@{ State of the last block computation, used to decide whether the blocks can be reused
+  bool _blocks_computed;
+  unsigned int _setups_since_compute;
+  int _blocks_time_step;
+  unsigned int _blocks_mesh_changed_count;
+  ///@}
+
+  ///@{
+  /**
+   * Local dofs of each variable in the nonlinear system and the matching dofs of its
+   * preconditioning system, cached so apply() moves the values without walking the mesh.
+   */
+  std::vector<std::vector<numeric_index_type>> _nl_dofs;
+  std::vector<std::vector<numeric_index_type>> _block_dofs;
+  bool _dof_maps_built;
+  unsigned int _dof_maps_mesh_changed_count;
+  ///@}
+
+  /// Scratch storage for the values moved between the systems
+  std::vector<Number> _values;
+
+  /// Build the dof maps for the current mesh
+  void buildDofMaps();
 };
 
 #endif // PHYSICSBASEDPRECONDITIONER_H
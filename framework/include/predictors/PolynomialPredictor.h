@@ -0,0 +1,63 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef POLYNOMIALPREDICTOR_H
+#define POLYNOMIALPREDICTOR_H
+
+// MOOSE includes
+#include "Predictor.h"
+
+// Forward declarations
+class PolynomialPredictor;
+
+template <>
+InputParameters validParams<PolynomialPredictor>();
+
+/**
+ * Predicts the initial guess of a step by evaluating the Lagrange polynomial through the last
+ * order + 1 converged solutions at the new time. The most recent solution is the old solution of
+ * the TimeIntegrator, the earlier ones are kept in a history of 'order' vectors. The prediction
+ * is rejected when its residual is larger than the one of the unpredicted solution.
+ */
+class PolynomialPredictor : public Predictor
+{
+public:
+  PolynomialPredictor(const InputParameters & parameters);
+
+  virtual int order() override { return _order; }
+  virtual void timestepSetup() override;
+  virtual bool shouldApply() override;
+  virtual void apply(NumericVector<Number> & sln) override;
+
+protected:
+  /// Maximum degree of the extrapolation polynomial
+  const unsigned int _order;
+
+  /// Whether to fall back to the unpredicted solution when the prediction increases the residual
+  const bool _reject_worse_prediction;
+
+  /// Solutions before the old one, most recent first
+  std::vector<NumericVector<Number> *> _history;
+
+  /// Times of the history solutions
+  std::vector<Real> & _history_times;
+
+  /// Time step the history was last shifted for
+  int & _t_step_old;
+
+  /// Solution before the prediction, restored when the prediction is rejected
+  NumericVector<Number> & _unpredicted_solution;
+};
+
+#endif /* POLYNOMIALPREDICTOR_H */
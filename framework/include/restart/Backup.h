@@ -16,9 +16,23 @@
 #define BACKUP_H
 
 // C++ includes
+#include <map>
+#include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 
+#include "libmesh/libmesh_common.h"
+
+// Forward declarations
+class RestartableDataValue;
+
+namespace libMesh
+{
+template <typename T>
+class NumericVector;
+}
+
 /**
  * Helper class to hold streams for Backup and Restore operations.
  */
@@ -32,6 +46,18 @@ public:
   std::stringstream _system_data;
 
   std::vector<std::stringstream *> _restartable_data;
+
+  /// In-memory copies of restartable data (per thread), filled by MooseApp::snapshot()
+  std::vector<std::map<std::string, std::unique_ptr<RestartableDataValue>>> _restartable_snapshots;
+
+  /// Copies of the solution vectors of the systems, filled by MooseApp::memoryBackup()
+  std::vector<std::unique_ptr<libMesh::NumericVector<libMesh::Number>>> _system_vectors;
+
+  /// Restartable data (per thread) that can not be copied, stored by MooseApp::memoryBackup()
+  std::vector<std::map<std::string, std::unique_ptr<std::stringstream>>> _streamed_data;
+
+  /// Whether this Backup holds an in-memory copy made by MooseApp::memoryBackup()
+  bool _in_memory = false;
 };
 
 // Specializations for dataLoad and dataStore appear in DataIO.C
@@ -25,10 +25,6 @@
 #include "libmesh/vector_value.h"
 #include "libmesh/tensor_value.h"
 #include "libmesh/parallel.h"
-#ifdef LIBMESH_HAVE_CXX11_TYPE_TRAITS
-#include <type_traits>
-#endif
-
 // C++ includes
 #include <string>
 #include <vector>
@@ -36,6 +32,7 @@
 #include <iostream>
 #include <map>
 #include <unordered_map>
+#include <type_traits>
 
 // Forward declarations
 class ColumnMajorMatrix;
@@ -149,6 +146,58 @@ inline void loadHelper(std::istream & stream, HashMap<P, Q> & data, void * conte
 template <typename T>
 inline void dataStore(std::ostream & stream, T & v, void * /*context*/);
 
+/**
+ * Trait for types whose dataStore() and dataLoad() write and read exactly the bytes the object
+ * occupies in memory. Contiguous sequences of these types are serialized with a single bulk
+ * write (or read) instead of one call per entry, without changing the stream format.
+ * Specialize this for additional types whose serialized form matches their memory layout.
+ */
+template <typename T>
+struct DataIOBulkCopyable
+{
+  static constexpr bool value = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value;
+};
+
+template <>
+struct DataIOBulkCopyable<RealVectorValue>
+{
+  static constexpr bool value = sizeof(RealVectorValue) == LIBMESH_DIM * sizeof(Real);
+};
+
+template <>
+struct DataIOBulkCopyable<RealTensorValue>
+{
+  static constexpr bool value = sizeof(RealTensorValue) == LIBMESH_DIM * LIBMESH_DIM * sizeof(Real);
+};
+
+/**
+ * Stores the size objects starting at data, these helpers are used by the contiguous containers.
+ */
+template <typename T>
+inline void
+dataStoreContiguous(std::ostream & stream, T * data, std::size_t size, void * context)
+{
+  if (DataIOBulkCopyable<T>::value)
+    stream.write((char *)data, sizeof(T) * size);
+  else
+    for (std::size_t i = 0; i < size; i++)
+      storeHelper(stream, data[i], context);
+}
+
+/**
+ * Loads the size objects starting at data, these helpers are used by the contiguous containers.
+ */
+template <typename T>
+inline void
+dataLoadContiguous(std::istream & stream, T * data, std::size_t size, void * context)
+{
+  if (DataIOBulkCopyable<T>::value)
+    stream.read((char *)data, sizeof(T) * size);
+  else
+    for (std::size_t i = 0; i < size; i++)
+      loadHelper(stream, data[i], context);
+}
+
 // global store functions
 
 template <typename T>
@@ -194,8 +243,21 @@ dataStore(std::ostream & stream, std::vector<T> & v, void * context)
   unsigned int size = v.size();
   stream.write((char *)&size, sizeof(size));
 
+  dataStoreContiguous(stream, v.data(), size, context);
+}
+
+inline void
+dataStore(std::ostream & stream, std::vector<bool> & v, void * context)
+{
+  // std::vector<bool> is not contiguous, store the entries one by one
+  unsigned int size = v.size();
+  stream.write((char *)&size, sizeof(size));
+
   for (unsigned int i = 0; i < size; i++)
-    storeHelper(stream, v[i], context);
+  {
+    bool b = v[i];
+    storeHelper(stream, b, context);
+  }
 }
 
 template <typename T>
@@ -381,8 +443,24 @@ dataLoad(std::istream & stream, std::vector<T> & v, void * context)
 
   v.resize(size);
 
+  dataLoadContiguous(stream, v.data(), size, context);
+}
+
+inline void
+dataLoad(std::istream & stream, std::vector<bool> & v, void * context)
+{
+  // std::vector<bool> is not contiguous, load the entries one by one
+  unsigned int size = 0;
+  stream.read((char *)&size, sizeof(size));
+
+  v.resize(size);
+
   for (unsigned int i = 0; i < size; i++)
-    loadHelper(stream, v[i], context);
+  {
+    bool b;
+    loadHelper(stream, b, context);
+    v[i] = b;
+  }
 }
 
 template <typename T>
@@ -19,11 +19,52 @@
 #include "DataIO.h"
 
 // C++ includes
+#include <map>
+#include <memory>
+#include <set>
+#include <type_traits>
 #include <vector>
 
 // Forward declarations
 class RestartableDataValue;
 
+/**
+ * Whether a restartable type holds data keyed by element that is merged with the stored value
+ * when it is loaded, so that the blocks of several processors can be loaded into it.  Such data
+ * is redistributed when recovering on a different number of processors.
+ */
+template <typename T>
+struct RestartableDataByElement : std::false_type
+{
+};
+
+/**
+ * Whether a restartable type can be copied into an in-memory snapshot.  std::is_copy_assignable
+ * reports true for containers of non-copyable types, so the common containers are unwrapped.
+ */
+template <typename T>
+struct RestartableSnapshotCopyable : std::is_copy_assignable<T>
+{
+};
+
+template <typename T>
+struct RestartableSnapshotCopyable<std::vector<T>> : RestartableSnapshotCopyable<T>
+{
+};
+
+template <typename T>
+struct RestartableSnapshotCopyable<std::set<T>> : RestartableSnapshotCopyable<T>
+{
+};
+
+template <typename K, typename V>
+struct RestartableSnapshotCopyable<std::map<K, V>>
+  : std::integral_constant<bool,
+                           RestartableSnapshotCopyable<K>::value &&
+                               RestartableSnapshotCopyable<V>::value>
+{
+};
+
 /**
  * Abstract definition of a RestartableData value.
  */
@@ -60,6 +101,27 @@ public:
 
   virtual void swap(RestartableDataValue * rhs) = 0;
 
+  /**
+   * Create an in-memory copy of this data, or nullptr if the type can not be copied.
+   */
+  virtual std::unique_ptr<RestartableDataValue> snapshot() = 0;
+
+  /**
+   * Exchange the stored value with the one held by a snapshot of this data.
+   */
+  virtual void restoreSnapshot(RestartableDataValue & snapshot) = 0;
+
+  /**
+   * Copy the value held by another instance of this data (the live value or a snapshot of it)
+   * into this one.  Does nothing if the type can not be copied.
+   */
+  virtual void copyFrom(RestartableDataValue & rhs) = 0;
+
+  /**
+   * Whether the data is keyed by element, see RestartableDataByElement.
+   */
+  virtual bool byElement() const = 0;
+
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
@@ -112,6 +174,26 @@ public:
    */
   virtual void swap(RestartableDataValue * rhs) override;
 
+  /**
+   * In-memory snapshot
+   */
+  virtual std::unique_ptr<RestartableDataValue> snapshot() override;
+
+  /**
+   * Restore from an in-memory snapshot
+   */
+  virtual void restoreSnapshot(RestartableDataValue & snapshot) override;
+
+  /**
+   * Copy from another instance of this data
+   */
+  virtual void copyFrom(RestartableDataValue & rhs) override;
+
+  /**
+   * Whether the data is keyed by element
+   */
+  virtual bool byElement() const override { return RestartableDataByElement<T>::value; }
+
   /**
    * Store the RestartableData into a binary stream
    */
@@ -123,6 +205,15 @@ public:
   virtual void load(std::istream & stream) override;
 
 private:
+  std::unique_ptr<RestartableDataValue> snapshotHelper(std::true_type);
+  std::unique_ptr<RestartableDataValue> snapshotHelper(std::false_type) { return nullptr; }
+
+  void restoreSnapshotHelper(RestartableDataValue & snapshot, std::true_type);
+  void restoreSnapshotHelper(RestartableDataValue &, std::false_type) {}
+
+  void copyFromHelper(RestartableDataValue & rhs, std::true_type);
+  void copyFromHelper(RestartableDataValue &, std::false_type) {}
+
   /// Stored value.
   T * _value_ptr;
 };
@@ -144,6 +235,54 @@ RestartableData<T>::swap(RestartableDataValue * libmesh_dbg_var(rhs))
   //  _value.swap(cast_ptr<RestartableData<T>*>(rhs)->_value);
 }
 
+template <typename T>
+inline std::unique_ptr<RestartableDataValue>
+RestartableData<T>::snapshot()
+{
+  return snapshotHelper(RestartableSnapshotCopyable<T>());
+}
+
+template <typename T>
+inline std::unique_ptr<RestartableDataValue>
+RestartableData<T>::snapshotHelper(std::true_type)
+{
+  std::unique_ptr<RestartableData<T>> copy(new RestartableData<T>(_name, _context));
+  *copy->_value_ptr = *_value_ptr;
+  return std::move(copy);
+}
+
+template <typename T>
+inline void
+RestartableData<T>::restoreSnapshot(RestartableDataValue & snapshot)
+{
+  restoreSnapshotHelper(snapshot, RestartableSnapshotCopyable<T>());
+}
+
+template <typename T>
+inline void
+RestartableData<T>::restoreSnapshotHelper(RestartableDataValue & snapshot, std::true_type)
+{
+  // Objects hold references to the stored value, so the contents are exchanged rather than the
+  // pointers; for the standard containers this is a constant time swap of their internals
+  using std::swap;
+  swap(*_value_ptr, *cast_ptr<RestartableData<T> *>(&snapshot)->_value_ptr);
+}
+
+template <typename T>
+inline void
+RestartableData<T>::copyFrom(RestartableDataValue & rhs)
+{
+  copyFromHelper(rhs, RestartableSnapshotCopyable<T>());
+}
+
+template <typename T>
+inline void
+RestartableData<T>::copyFromHelper(RestartableDataValue & rhs, std::true_type)
+{
+  // Assignment keeps the allocations of the containers that are already large enough
+  *_value_ptr = *cast_ptr<RestartableData<T> *>(&rhs)->_value_ptr;
+}
+
 template <typename T>
 inline void
 RestartableData<T>::store(std::ostream & stream)
@@ -177,5 +316,11 @@ public:
            ++j)
         delete j->second;
   }
+
+  /**
+   * The number of bytes all values occupy when stored (as in a checkpoint), taken as an
+   * estimate of their size in memory.  Nothing is buffered while counting.
+   */
+  std::size_t memoryFootprint() const;
 };
 #endif
@@ -18,6 +18,13 @@
 // MOOSE includes
 #include "DataIO.h"
 
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+#ifdef LIBMESH_HAVE_MPI
+#include <mpi.h>
+#endif
+
 // C++ includes
 #include <sstream>
 #include <string>
@@ -39,7 +46,7 @@ class RestartableDataIO
 public:
   RestartableDataIO(FEProblemBase & fe_problem);
 
-  virtual ~RestartableDataIO() = default;
+  virtual ~RestartableDataIO();
 
   /**
    * Write out the restartable data.
@@ -48,9 +55,31 @@ public:
                             const RestartableDatas & restartable_datas,
                             std::set<std::string> & _recoverable_data);
 
+  /**
+   * Write out the restartable data of all processors and threads into the single file
+   * \p file_name.  The file starts with an index of the block of each processor/thread; the blocks
+   * are written with MPI-IO collective writes.
+   *
+   * @param async If true this returns as soon as the data has been serialized into a buffer and the
+   * write happens in the background.  It is completed by finishSharedWrite(), which is called by
+   * the next write and the destructor.
+   */
+  void writeSharedRestartableData(const std::string & file_name,
+                                  const RestartableDatas & restartable_datas,
+                                  bool async = false);
+
+  /**
+   * Wait for an asynchronous writeSharedRestartableData() to complete (collective).
+   */
+  void finishSharedWrite();
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of
-   * processors and threads.
+   * processors and threads.  Both the per-processor files and the shared file written by
+   * writeSharedRestartableData() are supported.  The shared file is read with collective MPI-IO
+   * reads and may have been written on a different number of processors: the data stored by
+   * element (see RestartableDataByElement) is then loaded from the blocks of all processors, the
+   * rest from the block of processor (this processor % the number of processors that wrote it).
    */
   void readRestartableDataHeader(std::string base_file_name);
 
@@ -70,6 +99,20 @@ public:
    */
   void restoreBackup(std::shared_ptr<Backup> backup, bool for_restart = false);
 
+  /**
+   * Create a Backup for the current system and copy it into the POSIX shared memory segment
+   * \p name of this processor, where it outlives the application.  A later run on the same
+   * nodes and number of processors can pick it up with readSharedMemory() without going through
+   * the file system.
+   */
+  void writeSharedMemory(const std::string & name);
+
+  /**
+   * Build a Backup from the shared memory segment \p name of this processor written by
+   * writeSharedMemory().
+   */
+  std::shared_ptr<Backup> readSharedMemory(const std::string & name);
+
 private:
   /**
    * Serializes the data into the stream object.
@@ -86,6 +129,17 @@ private:
                              std::istream & stream,
                              const std::set<std::string> & recoverable_data);
 
+  /**
+   * Read the index of the shared file \p file_name and the blocks this processor loads from it.
+   */
+  void readSharedRestartableDataHeader(const std::string & file_name);
+
+  /**
+   * Read and check the header of the block held by \p stream, which has to have been written
+   * on \p n_procs processors.
+   */
+  void readBlockHeader(std::istream & stream, processor_id_type n_procs);
+
   /**
    * Serializes the data for the Systems in FEProblemBase
    */
@@ -96,11 +150,31 @@ private:
    */
   void deserializeSystems(std::istream & stream);
 
+  /**
+   * The name of the shared memory segment \p name of this processor
+   */
+  std::string sharedMemoryName(const std::string & name) const;
+
   /// Reference to a FEProblemBase being restarted
   FEProblemBase & _fe_problem;
 
-  /// A vector of file handles, one per thread
-  std::vector<std::shared_ptr<std::ifstream>> _in_file_handles;
+  /// A vector of input streams, one per thread
+  std::vector<std::shared_ptr<std::istream>> _in_file_handles;
+
+  /// The blocks of the other processors that the data stored by element is loaded from, per thread
+  std::vector<std::vector<std::shared_ptr<std::istream>>> _element_in_file_handles;
+
+  /// Data held for an in-flight shared write
+  std::vector<char> _write_buffer;
+
+#ifdef LIBMESH_HAVE_MPI
+  /// File and requests of an in-flight asynchronous shared write
+  MPI_File _write_file;
+  std::vector<MPI_Request> _write_requests;
+#endif
+
+  /// Whether an asynchronous shared write has not been completed yet
+  bool _write_pending;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
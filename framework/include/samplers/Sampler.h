@@ -67,6 +67,39 @@ public:
    */
   std::vector<DenseMatrix<Real>> getSamples();
 
+  ///@{
+  /**
+   * Row based access to the sampled data, which avoids building all the matrices.  The rows of the
+   * matrices are numbered consecutively, one matrix after the other; each matrix has a column per
+   * distribution.
+   */
+  dof_id_type getNumberOfRows();
+  unsigned int getNumberOfCols() const { return _distributions.size(); }
+  std::size_t getNumberOfMatrices();
+  dof_id_type getNumberOfRows(unsigned int matrix);
+
+  /**
+   * Return the matrix index and the row within that matrix of a global row.
+   */
+  std::pair<unsigned int, dof_id_type> getMatrixRow(dof_id_type global_row);
+
+  /**
+   * Compute the rows [begin, end) only.
+   */
+  DenseMatrix<Real> getLocalSamples(dof_id_type begin, dof_id_type end);
+
+  /**
+   * Start iterating over the rows [begin, end) with getNextLocalRow().
+   */
+  void resetLocalRows(dof_id_type begin, dof_id_type end);
+
+  /**
+   * Compute the next row of the range given to resetLocalRows().
+   * @return false when there are no rows left
+   */
+  bool getNextLocalRow(std::vector<Real> & data);
+  ///@}
+
   /**
    * Store the state of the MooseRandom generator so that new calls to getSamples will create
    * new numbers.
@@ -88,6 +121,31 @@ protected:
    */
   virtual std::vector<DenseMatrix<Real>> sample() = 0;
 
+  /**
+   * Return the number of rows of each of the matrices returned by sample().  The default
+   * implementation computes all the samples, override it along with sampleRow() to avoid that.
+   */
+  virtual std::vector<dof_id_type> sampleRowCounts();
+
+  /**
+   * Called by resetLocalRows() after the random number generator has been reset to the state
+   * getSamples() starts from.
+   */
+  virtual void sampleRowSetUp(){};
+
+  /**
+   * Compute a single row of a matrix returned by sample().  After sampleRowSetUp() this is called
+   * for increasing global rows, so the random numbers of the rows can be drawn in sequence.  The
+   * default implementation extracts the row from the output of sample().
+   */
+  virtual void sampleRow(unsigned int matrix, dof_id_type row, std::vector<Real> & data);
+
+  /**
+   * Reset the random number generator to the state getSamples() starts from, for use by
+   * sampleRow() when rows must be computed again from the start.
+   */
+  void restoreGenerator();
+
   /**
    * Set the number of seeds required by the sampler. The Sampler will generate
    * additional seeds as needed. This function should be called in the constructor
@@ -111,6 +169,16 @@ private:
 
   /// Initial random number seed
   const unsigned int & _seed;
+
+  /// The row counts of the matrices (empty until needed)
+  std::vector<dof_id_type> _row_counts;
+
+  /// Range of the rows given to resetLocalRows() and the next row to compute
+  dof_id_type _next_row;
+  dof_id_type _end_row;
+
+  /// The matrices used by the default sampleRow()
+  std::vector<DenseMatrix<Real>> _row_samples;
 };
 
 #endif /* SAMPLER_H */
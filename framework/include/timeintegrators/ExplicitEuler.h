@@ -15,7 +15,7 @@
 #ifndef EXPLICITEULER_H
 #define EXPLICITEULER_H
 
-#include "TimeIntegrator.h"
+#include "ExplicitTimeIntegrator.h"
 
 class ExplicitEuler;
 
@@ -25,7 +25,7 @@ InputParameters validParams<ExplicitEuler>();
 /**
  * Explicit Euler time integrator
  */
-class ExplicitEuler : public TimeIntegrator
+class ExplicitEuler : public ExplicitTimeIntegrator
 {
 public:
   ExplicitEuler(const InputParameters & parameters);
@@ -34,6 +34,7 @@ public:
   virtual void preSolve();
   virtual int order() { return 1; }
   virtual void computeTimeDerivatives();
+  virtual void solve();
   virtual void postStep(NumericVector<Number> & residual);
 
 protected:
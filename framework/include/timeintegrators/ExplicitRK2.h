@@ -15,7 +15,7 @@
 #ifndef EXPLICITRK2_H
 #define EXPLICITRK2_H
 
-#include "TimeIntegrator.h"
+#include "ExplicitTimeIntegrator.h"
 
 class ExplicitRK2;
 
@@ -62,7 +62,7 @@ InputParameters validParams<ExplicitRK2>();
  * them correctly!  An important exception are TimeDerivative kernels,
  * which should never be marked "implicit=false".
  */
-class ExplicitRK2 : public TimeIntegrator
+class ExplicitRK2 : public ExplicitTimeIntegrator
 {
 public:
   ExplicitRK2(const InputParameters & parameters);
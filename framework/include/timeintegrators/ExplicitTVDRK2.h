@@ -15,7 +15,7 @@
 #ifndef EXPLICITTVDRK2_H
 #define EXPLICITTVDRK2_H
 
-#include "TimeIntegrator.h"
+#include "ExplicitTimeIntegrator.h"
 
 class ExplicitTVDRK2;
 
@@ -53,7 +53,7 @@ InputParameters validParams<ExplicitTVDRK2>();
  * them correctly!  An important exception are TimeDerivative kernels,
  * which should never be marked "implicit=false".
  */
-class ExplicitTVDRK2 : public TimeIntegrator
+class ExplicitTVDRK2 : public ExplicitTimeIntegrator
 {
 public:
   ExplicitTVDRK2(const InputParameters & parameters);
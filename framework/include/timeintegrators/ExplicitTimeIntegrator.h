@@ -0,0 +1,83 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EXPLICITTIMEINTEGRATOR_H
+#define EXPLICITTIMEINTEGRATOR_H
+
+#include "TimeIntegrator.h"
+#include "MooseEnum.h"
+
+class ExplicitTimeIntegrator;
+
+template <>
+InputParameters validParams<ExplicitTimeIntegrator>();
+
+/**
+ * Base class for the explicit time integrators.
+ *
+ * With solve_type = consistent every stage is a nonlinear solve with the consistent mass
+ * matrix. With solve_type = lumped the row sums of the mass matrix are computed once from a
+ * residual evaluation of the time kernels and every stage is a single residual evaluation
+ * followed by a diagonal update, no matrix is assembled and no linear system is solved.
+ *
+ * The lumped mass is obtained from the residual of the time kernels at u_dot = 1, so it is only
+ * valid for time kernels whose residual is linear in u_dot (e.g. TimeDerivative) with time
+ * independent coefficients. Rows set by nodal boundary conditions take a unit diagonal, which
+ * enforces Dirichlet type conditions exactly.
+ */
+class ExplicitTimeIntegrator : public TimeIntegrator
+{
+public:
+  ExplicitTimeIntegrator(const InputParameters & parameters);
+
+  virtual bool needsInitialResidual() const override { return !_lumped; }
+
+protected:
+  /**
+   * Solve the current stage, either with the nonlinear solver or with the lumped mass update
+   */
+  void solveStage();
+
+  /**
+   * The residual of the time kernels to combine in postStep(): the consistent one, or the
+   * lumped mass times u_dot.
+   */
+  const NumericVector<Number> & timeResidual();
+
+  /**
+   * Compute the row sums of the mass matrix
+   */
+  void computeLumpedMass();
+
+  /// Whether the lumped mass fast path is used
+  const bool _lumped;
+
+  ///@{
+  /// Row sums of the mass matrix, the lumped time residual and the stage residual (lumped only)
+  NumericVector<Number> * _mass_lumped;
+  NumericVector<Number> * _lumped_time_residual;
+  NumericVector<Number> * _explicit_residual;
+  ///@}
+
+  /// Number of dofs the lumped mass was computed for, 0 if it was not computed yet
+  dof_id_type _mass_n_dofs;
+
+  /// Set while the time kernels are evaluated for the lumped mass
+  bool _computing_mass;
+
+  /// Local dofs with rows set by nodal boundary conditions
+  std::vector<dof_id_type> _nodal_bc_dofs;
+};
+
+#endif /* EXPLICITTIMEINTEGRATOR_H */
@@ -74,6 +74,12 @@ public:
    */
   virtual void postSolve() {}
 
+  /**
+   * Whether NonlinearSystem::solve() needs the initial residual for the nonlinear convergence
+   * check, integrators that do not run a nonlinear solve can skip it.
+   */
+  virtual bool needsInitialResidual() const { return true; }
+
   virtual int order() = 0;
   virtual void computeTimeDerivatives() = 0;
 
@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "MeshChangedInterface.h"
 
 // Forward declarations
 class MultiAppInterpolationTransfer;
@@ -27,7 +28,7 @@ InputParameters validParams<MultiAppInterpolationTransfer>();
 /**
  * Copy the value to the target domain from the nearest node in the source domain.
  */
-class MultiAppInterpolationTransfer : public MultiAppTransfer
+class MultiAppInterpolationTransfer : public MultiAppTransfer, public MeshChangedInterface
 {
 public:
   MultiAppInterpolationTransfer(const InputParameters & parameters);
@@ -36,7 +37,23 @@ public:
 
   virtual void execute() override;
 
+  virtual void meshChanged() override;
+
 protected:
+  /**
+   * Inverse distance interpolation with weights that are computed once and reused until the
+   * meshes change.
+   */
+  void executeCached();
+
+  /// The interpolation of a target dof from the gathered source values
+  struct TargetWeights
+  {
+    dof_id_type dof;
+    std::vector<std::size_t> indices;
+    std::vector<Real> weights;
+  };
+
   /**
    * Return the nearest node to the point p.
    * @param p The point you want to find the nearest node to.
@@ -57,6 +74,15 @@ protected:
   Real _power;
   MooseEnum _interp_type;
   Real _radius;
+
+  /// Whether or not the interpolation weights are reused between executions
+  bool _cache_mapping;
+
+  /// False when the weights must be rebuilt on the next execution
+  bool _mapping_valid;
+
+  /// The weights for the local target dofs of each "to" problem
+  std::vector<std::vector<TargetWeights>> _target_weights;
 };
 
 #endif /* MULTIAPPINTERPOLATIONTRANSFER_H */
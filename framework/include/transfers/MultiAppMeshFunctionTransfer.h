@@ -16,6 +16,7 @@
 #define MULTIAPPMESHFUNCTIONTRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "MeshChangedInterface.h"
 
 // Forward declarations
 class MultiAppMeshFunctionTransfer;
@@ -28,7 +29,7 @@ InputParameters validParams<MultiAppMeshFunctionTransfer>();
  * the MultiApp is.  Copies that value into a postprocessor in the
  * MultiApp.
  */
-class MultiAppMeshFunctionTransfer : public MultiAppTransfer
+class MultiAppMeshFunctionTransfer : public MultiAppTransfer, public MeshChangedInterface
 {
 public:
   MultiAppMeshFunctionTransfer(const InputParameters & parameters);
@@ -37,10 +38,65 @@ public:
 
   virtual void execute() override;
 
+  /// Evaluates the source variable and posts the values to the processors that need them
+  virtual void startExecute() override;
+
+  /// Receives the values and applies them to the target variable
+  virtual void finishExecute() override;
+
+  virtual void meshChanged() override;
+
 protected:
+  /**
+   * Find the points of the target variable, send them to the processors whose source domains
+   * contain them, and store how to evaluate the source variable at the points received.
+   */
+  void buildMapping();
+
+  /// The evaluation of the source variable at a point, as a combination of the element dofs
+  struct SourceEvaluation
+  {
+    SourceEvaluation() : from(libMesh::invalid_uint) {}
+
+    /// The local "from" problem containing the point, invalid_uint when none does
+    unsigned int from;
+
+    /// The dofs of the source element and the values of their shape functions at the point
+    std::vector<dof_id_type> dofs;
+    std::vector<Real> phi;
+  };
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
   bool _error_on_miss;
+
+  /// Whether or not the mapping is reused between executions
+  bool _cache_mapping;
+
+  /// False when the mapping must be rebuilt on the next execution
+  bool _mapping_valid;
+
+  /// The index of each local target point in the points sent to a processor:
+  /// _point_index_map[i_proc][i_to, node or element id] = index
+  std::vector<std::map<std::pair<unsigned int, unsigned int>, unsigned int>> _point_index_map;
+
+  /// The evaluations for the points received from each processor
+  std::vector<std::vector<SourceEvaluation>> _source_evaluations;
+
+  /// Tag of the evaluation messages, unique so that overlapping transfers do not mix them up
+  const Parallel::MessageTag _evals_tag;
+
+  /// True between startExecute() and finishExecute()
+  bool _executing;
+
+  ///@{ Buffers of a started transfer, by processor
+  std::vector<std::vector<Real>> _outgoing_evals;
+  std::vector<std::vector<unsigned int>> _outgoing_ids;
+  std::vector<Parallel::Request> _send_evals;
+  std::vector<Parallel::Request> _send_ids;
+  std::vector<std::vector<Real>> _incoming_evals;
+  std::vector<std::vector<unsigned int>> _incoming_app_ids;
+  ///@}
 };
 
 #endif /* MULTIAPPMESHFUNCTIONTRANSFER_H */
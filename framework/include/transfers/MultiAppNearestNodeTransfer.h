@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 // Forward declarations
 class MultiAppNearestNodeTransfer;
@@ -69,6 +70,44 @@ protected:
 
   void getLocalNodes(MooseMesh * mesh, std::vector<Node *> & local_nodes);
 
+  /**
+   * A k-d tree over the source nodes of one mesh along with the nodes it was built from.
+   * The tree is only rebuilt when the mesh changes or is displaced.
+   */
+  struct SourceNodeTree
+  {
+    /// The mesh the tree was built for
+    MooseMesh * mesh = nullptr;
+
+    /// The value of MooseMesh::meshChangedCount() when the tree was built
+    unsigned int mesh_changed_count = 0;
+
+    /// The offset applied to every node position
+    Point offset;
+
+    /// The nodes that were inserted into the tree, in tree index order
+    std::vector<Node *> nodes;
+
+    std::unique_ptr<KDTree> tree;
+  };
+
+  /**
+   * Make sure \p cache holds an up-to-date k-d tree over the source nodes of \p mesh.
+   * @param cache The cached tree to update.
+   * @param mesh The mesh that owns the nodes.
+   * @param local true to only insert local nodes, otherwise all nodes are inserted
+   * @param offset A translation applied to every node position.
+   * @param sys_num The system of the source variable.
+   * @param var_num Only nodes with a dof of this variable are inserted (pass
+   * libMesh::invalid_uint to insert all nodes).
+   */
+  void updateSourceNodeTree(SourceNodeTree & cache,
+                            MooseMesh * mesh,
+                            bool local,
+                            const Point & offset,
+                            unsigned int sys_num = libMesh::invalid_uint,
+                            unsigned int var_num = libMesh::invalid_uint);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
@@ -87,6 +126,12 @@ protected:
   std::vector<std::vector<dof_id_type>> & _cached_dof_ids;
   std::map<dof_id_type, unsigned int> & _cached_from_inds;
   std::map<dof_id_type, unsigned int> & _cached_qp_inds;
+
+  /// Spatial indices over the local nodes of each local "from" mesh
+  std::vector<SourceNodeTree> _source_trees;
+
+  /// Spatial indices used by getNearestNode(), indexed by the "local" flag
+  std::map<std::pair<MooseMesh *, bool>, SourceNodeTree> _nearest_node_trees;
 };
 
 #endif /* MULTIAPPNEARESTNODETRANSFER_H */
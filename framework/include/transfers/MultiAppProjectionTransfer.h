@@ -16,12 +16,52 @@
 
 #include "MultiAppTransfer.h"
 
+// libMesh includes
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+#include "libmesh/elem_range.h"
+#include "libmesh/threads.h"
+
 // Forward declarations
 namespace libMesh
 {
 class LinearImplicitSystem;
+class System;
 }
 
+/**
+ * Computes the element contributions of the L2 projection system from the stashed source
+ * evaluations.  The global matrix and right-hand side are not thread safe, so filling them
+ * is left to the caller.
+ */
+class ProjectionAssemblyThread
+{
+public:
+  ProjectionAssemblyThread(const System & system,
+                           const std::vector<Real> & final_evals,
+                           const std::map<dof_id_type, unsigned int> & element_map,
+                           bool compute_matrix);
+  // Splitting Constructor
+  ProjectionAssemblyThread(ProjectionAssemblyThread & x, Threads::split split);
+
+  void operator()(const ConstElemRange & range);
+
+  void join(const ProjectionAssemblyThread & y);
+
+  /// The dof indices of every assembled element
+  std::vector<std::vector<dof_id_type>> _dof_indices;
+  /// The element right-hand sides
+  std::vector<DenseVector<Number>> _rhs;
+  /// The element matrices, empty when the matrix is not being computed
+  std::vector<DenseMatrix<Number>> _matrices;
+
+protected:
+  const System & _system;
+  const std::vector<Real> & _final_evals;
+  const std::map<dof_id_type, unsigned int> & _element_map;
+  const bool _compute_matrix;
+};
+
 class MultiAppProjectionTransfer;
 
 template <>
@@ -45,6 +85,15 @@ protected:
 
   void assembleL2(EquationSystems & es, const std::string & system_name);
 
+  /**
+   * Evaluate the local "from" problem \p i_from at the points \p qps, grouped by the
+   * element containing them, and store the values in \p evals.
+   */
+  void evaluateFromElements(unsigned int i_from,
+                            const std::vector<Point> & qps,
+                            const std::map<const Elem *, std::vector<unsigned int>> & elem_qps,
+                            std::vector<Real> & evals);
+
   void projectSolution(unsigned int to_problem);
 
   AuxVariableName _to_var_name;
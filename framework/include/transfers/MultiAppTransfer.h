@@ -26,6 +26,7 @@
 class MultiAppTransfer;
 class MooseMesh;
 class MultiApp;
+class MeshChangedInterface;
 
 template <>
 InputParameters validParams<MultiAppTransfer>();
@@ -111,6 +112,18 @@ protected:
 
   // Given local app index, returns global app index.
   std::vector<unsigned int> _local2global_map;
+
+  /**
+   * Return true if getAppInfo() found the same problems at the same positions as in the previous
+   * call, for Transfers that reuse data derived from the meshes.  Problems that were not seen
+   * before are set to notify the given object when their mesh changes.
+   */
+  bool sameAppInfo(MeshChangedInterface * mci);
+
+private:
+  /// The problems and positions seen by the previous call to sameAppInfo()
+  std::vector<FEProblemBase *> _previous_problems;
+  std::vector<Point> _previous_positions;
 };
 
 #endif /* MULTIAPPTRANSFER_H */
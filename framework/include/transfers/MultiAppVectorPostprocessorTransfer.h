@@ -0,0 +1,55 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MULTIAPPVECTORPOSTPROCESSORTRANSFER_H
+#define MULTIAPPVECTORPOSTPROCESSORTRANSFER_H
+
+#include "MultiAppTransfer.h"
+
+// Forward declarations
+class MultiAppVectorPostprocessorTransfer;
+
+template <>
+InputParameters validParams<MultiAppVectorPostprocessorTransfer>();
+
+/**
+ * Transfers a set of Postprocessors of every app of a MultiApp to or from the vectors of a
+ * VectorPostprocessor in the Master, which hold one entry per app. From the MultiApp, the values
+ * of all apps and Postprocessors are gathered with a single collective operation.
+ */
+class MultiAppVectorPostprocessorTransfer : public MultiAppTransfer
+{
+public:
+  MultiAppVectorPostprocessorTransfer(const InputParameters & parameters);
+
+  virtual void execute() override;
+
+protected:
+  /// Sets the Postprocessors of the local apps from the entries of the Master vectors
+  void executeToMultiapp();
+
+  /// Gathers the Postprocessors of all apps into the Master vectors
+  void executeFromMultiapp();
+
+  /// The Postprocessors in the MultiApp
+  const std::vector<PostprocessorName> & _sub_pp_names;
+
+  /// The VectorPostprocessor in the Master
+  const VectorPostprocessorName & _master_vpp_name;
+
+  /// The vectors of the Master VectorPostprocessor, one per Postprocessor
+  std::vector<VectorPostprocessorValue *> _vectors;
+};
+
+#endif /* MULTIAPPVECTORPOSTPROCESSORTRANSFER_H */
@@ -54,6 +54,19 @@ public:
    */
   virtual void execute() = 0;
 
+  /**
+   * Split phase execution: post the transfer and return without waiting for the data from the
+   * other processors when possible. All transfers of an execution are started before the first one
+   * is finished, so that their communication overlaps the work of the others. By default this
+   * performs the complete transfer.
+   */
+  virtual void startExecute() { execute(); }
+
+  /**
+   * Complete a transfer posted with startExecute().
+   */
+  virtual void finishExecute() {}
+
   /**
    * Method called at the beginning of the simulation for checking integrity or doing
    * one-time setup.
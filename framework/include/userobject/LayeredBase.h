@@ -121,6 +121,12 @@ private:
   /// Whether or not each layer has had any value summed into it
   std::vector<bool> _layer_has_value;
 
+  /// For each layer the closest layer at or above it that has a value (-1 when there is none)
+  std::vector<int> _higher_layer;
+
+  /// For each layer the closest layer below it that has a value (-1 when there is none)
+  std::vector<int> _lower_layer;
+
   /// Subproblem for the child object
   SubProblem & _layered_base_subproblem;
 
@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "ElementIntegralVariableUserObject.h"
+#include "KDTree.h"
 
 // Forward Declarations
 class UserObject;
@@ -83,12 +84,18 @@ protected:
   std::shared_ptr<UserObjectType> nearestUserObject(const Point & p) const;
 
   std::vector<Point> _points;
+
+  /// Tree over _points to find the closest one without scanning all of them
+  const KDTree _points_tree;
+
   std::vector<std::shared_ptr<UserObjectType>> _user_objects;
 };
 
 template <typename UserObjectType>
 NearestPointBase<UserObjectType>::NearestPointBase(const InputParameters & parameters)
-  : ElementIntegralVariableUserObject(parameters), _points(getParam<std::vector<Point>>("points"))
+  : ElementIntegralVariableUserObject(parameters),
+    _points(getParam<std::vector<Point>>("points")),
+    _points_tree(_points)
 {
   _user_objects.reserve(_points.size());
 
@@ -146,21 +153,16 @@ template <typename UserObjectType>
 std::shared_ptr<UserObjectType>
 NearestPointBase<UserObjectType>::nearestUserObject(const Point & p) const
 {
-  unsigned int closest = 0;
-  Real closest_distance = std::numeric_limits<Real>::max();
-
-  for (unsigned int i = 0; i < _points.size(); i++)
-  {
-    const Point & current_point = _points[i];
-
-    Real current_distance = (p - current_point).norm();
-
-    if (current_distance < closest_distance)
-    {
-      closest_distance = current_distance;
-      closest = i;
-    }
-  }
+  std::size_t closest = 0;
+  Real closest_distance;
+  _points_tree.neighborSearch(p, closest, closest_distance);
+
+  // When several points are equally close take the first one, so that elements lying midway
+  // between points are lumped independently of the shape of the tree
+  std::vector<std::size_t> equally_close;
+  _points_tree.radiusSearch(p, closest_distance, equally_close);
+  for (const auto i : equally_close)
+    closest = std::min(closest, i);
 
   return _user_objects[closest];
 }
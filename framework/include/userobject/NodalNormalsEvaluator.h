@@ -19,6 +19,7 @@
 
 class NodalNormalsEvaluator;
 class AuxiliarySystem;
+class NodalNormalsPreprocessor;
 
 template <>
 InputParameters validParams<NodalNormalsEvaluator>();
@@ -31,6 +32,8 @@ class NodalNormalsEvaluator : public NodalUserObject
 public:
   NodalNormalsEvaluator(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual void initialize() override;
   virtual void finalize() override;
   virtual void execute() override;
@@ -38,6 +41,9 @@ public:
 
 protected:
   AuxiliarySystem & _aux;
+
+  /// The preprocessor that decides which normals are recomputed (nullptr: all of them)
+  const NodalNormalsPreprocessor * _preprocessor;
 };
 
 #endif /* NODALNORMALSEVALUATOR_H */
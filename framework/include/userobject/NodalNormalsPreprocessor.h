@@ -22,6 +22,8 @@
 // libMesh includes
 #include "libmesh/fe_type.h"
 
+#include <unordered_map>
+
 // Forward declarations
 class NodalNormalsPreprocessor;
 class AuxiliarySystem;
@@ -59,13 +61,52 @@ public:
    */
   virtual bool boundaryRestricted() override { return false; }
 
+  /**
+   * Whether any nodal normal is recomputed during the current execution. The normals are only
+   * recomputed on the first execution, after the mesh changed and on the boundaries touching
+   * elements that moved since the last execution (displaced meshes).
+   */
+  bool hasUpdates() const { return _primary->_has_updates; }
+
+  /**
+   * Whether the normal at the given node is recomputed during the current execution
+   */
+  bool needsUpdate(const Node * node) const;
+
 protected:
+  /**
+   * Compares the local element nodes against the positions of the last execution and collects
+   * the boundaries whose normals need to be recomputed (thread 0 only)
+   */
+  void checkGeometry();
+
   AuxiliarySystem & _aux;
   FEType _fe_type;
   bool _has_corners;
   BoundaryID _corner_boundary_id;
 
   const VariablePhiGradient & _grad_phi;
+
+  /// The copy of this object on thread 0, which holds the update state
+  const NodalNormalsPreprocessor * _primary;
+
+  /// Recompute all normals (first execution or changed mesh)
+  bool _update_all;
+
+  /// Whether anything is recomputed
+  bool _has_updates;
+
+  /// Boundaries touching elements that moved since the last execution
+  std::set<BoundaryID> _moved_boundaries;
+
+  /// Positions of the local element nodes at the last execution
+  std::unordered_map<dof_id_type, Point> _node_positions;
+
+  /// The mesh changed count of the last execution
+  unsigned int _mesh_changed_count;
+
+  /// Whether the normals have been computed before
+  bool _computed;
 };
 
 #endif /* NODALNORMALSPREPROCESSOR_H */
@@ -262,36 +262,52 @@ protected:
    */
   bool updateExodusBracketingTimeIndices(Real time);
 
+  /**
+   * Build a MeshFunction over the data read from the file (interpolated in time when
+   * interpolating)
+   */
+  std::unique_ptr<MeshFunction> buildMeshFunction() const;
+
+  /**
+   * Take an idle MeshFunction out of the pool (building one if there is none). MeshFunction and
+   * its point locator are not thread safe, so every evaluating thread uses its own and only the
+   * pool itself is locked.
+   */
+  std::unique_ptr<MeshFunction> acquireMeshFunction() const;
+
+  /**
+   * Return a MeshFunction taken with acquireMeshFunction() to the pool
+   */
+  void releaseMeshFunction(std::unique_ptr<MeshFunction> mesh_function) const;
+
+  /**
+   * Interpolate _interpolated_solution between the two bracketing time steps with
+   * _interpolation_factor
+   */
+  void updateInterpolatedSolution();
+
   /**
    * A wrapper method for calling the various MeshFunctions used for reading the data
    * @param p The location at which data is desired
    * @param local_var_index The local index of the variable to extract data from
-   * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
    */
-  Real evalMeshFunction(const Point & p,
-                        const unsigned int local_var_index,
-                        unsigned int func_num) const;
+  Real evalMeshFunction(const Point & p, const unsigned int local_var_index) const;
 
   /**
    * A wrapper method for calling the various MeshFunctions that calls the mesh function
    * functionality for evaluating discontinuous shape functions near a face (where it's multivalued)
    * @param p The location at which data is desired
    * @param local_var_index The local index of the variable to extract data from
-   * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
    */
   std::map<const Elem *, Real> evalMultiValuedMeshFunction(const Point & p,
-                                                           const unsigned int local_var_index,
-                                                           unsigned int func_num) const;
+                                                           unsigned int local_var_index) const;
 
   /**
    * A wrapper method interfacing with the libMesh mesh function for evaluating the gradient
    * @param p The location at which data is desired
    * @param local_var_index The local index of the variable to extract data from
-   * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
    */
-  RealGradient evalMeshFunctionGradient(const Point & p,
-                                        const unsigned int local_var_index,
-                                        unsigned int func_num) const;
+  RealGradient evalMeshFunctionGradient(const Point & p, const unsigned int local_var_index) const;
 
   /**
    * A wrapper method interfacing with the libMesh mesh function that calls the gradient
@@ -299,10 +315,9 @@ protected:
    * multivalued)
    * @param p The location at which data is desired
    * @param local_var_index The local index of the variable to extract data from
-   * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
    */
   std::map<const Elem *, RealGradient> evalMultiValuedMeshFunctionGradient(
-      const Point & p, const unsigned int local_var_index, unsigned int func_num) const;
+      const Point & p, const unsigned int local_var_index) const;
 
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
@@ -340,8 +355,11 @@ protected:
   /// Pointer libMesh::System class storing the read solution
   System * _system;
 
-  /// Pointer the libMesh::MeshFunction object that the read data is stored
-  std::unique_ptr<MeshFunction> _mesh_function;
+  /// The variable numbers the MeshFunctions are built for
+  std::vector<unsigned int> _var_nums;
+
+  /// The idle libMesh::MeshFunction objects for the read data
+  mutable std::vector<std::unique_ptr<MeshFunction>> _mesh_function;
 
   /// Pointer to the libMesh::ExodusII used to read the files
   std::unique_ptr<ExodusII_IO> _exodusII_io;
@@ -355,8 +373,8 @@ protected:
   /// Pointer to a second libMesh::System object, used for interpolation
   System * _system2;
 
-  /// Pointer to second libMesh::MeshFuntion, used for interpolation
-  std::unique_ptr<MeshFunction> _mesh_function2;
+  /// The solution interpolated in time between both systems, evaluated by the MeshFunctions
+  std::unique_ptr<NumericVector<Number>> _interpolated_solution;
 
   /// Pointer to second serial solution, used for interpolation
   std::unique_ptr<NumericVector<Number>> _serialized_solution2;
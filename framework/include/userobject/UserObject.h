@@ -142,7 +142,31 @@ public:
     _communicator.broadcast(proxy, rank);
   }
 
+  ///@{
+  /**
+   * The values registered with deferSum(), deferMax() and deferMin(). FEProblemBase reduces the
+   * values of all of the UserObjects that are finalized together with a single collective per
+   * operation, right after threadJoin() and before finalize().
+   */
+  const std::vector<Real *> & deferredSums() const { return _deferred_sums; }
+  const std::vector<unsigned int *> & deferredCountSums() const { return _deferred_count_sums; }
+  const std::vector<Real *> & deferredMaxs() const { return _deferred_maxs; }
+  const std::vector<Real *> & deferredMins() const { return _deferred_mins; }
+  ///@}
+
 protected:
+  ///@{
+  /**
+   * Register a member to be summed (or maxed, or min'ed) over all CPUs before finalize() instead
+   * of calling gatherSum() (gatherMax(), gatherMin()) on it. The threads must already have been
+   * joined into it by threadJoin().
+   */
+  void deferSum(Real & value) { _deferred_sums.push_back(&value); }
+  void deferSum(unsigned int & value) { _deferred_count_sums.push_back(&value); }
+  void deferMax(Real & value) { _deferred_maxs.push_back(&value); }
+  void deferMin(Real & value) { _deferred_mins.push_back(&value); }
+  ///@}
+
   /// Reference to the Subproblem for this user object
   SubProblem & _subproblem;
 
@@ -157,6 +181,13 @@ protected:
   const Moose::CoordinateSystemType & _coord_sys;
 
   const bool _duplicate_initial_execution;
+
+private:
+  /// Values to be reduced over all CPUs before finalize()
+  std::vector<Real *> _deferred_sums;
+  std::vector<unsigned int *> _deferred_count_sums;
+  std::vector<Real *> _deferred_maxs;
+  std::vector<Real *> _deferred_mins;
 };
 
 #endif /* USEROBJECT_H */
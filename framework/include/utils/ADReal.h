@@ -0,0 +1,54 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ADREAL_H
+#define ADREAL_H
+
+// MOOSE includes
+#include "DualNumber.h"
+#include "MooseArray.h"
+
+// libMesh includes
+#include "libmesh/vector_value.h"
+
+/**
+ * The number of derivatives an ADReal carries. The degrees of freedom of all nonlinear variables
+ * on an element share them: variable v uses the derivatives starting at v times
+ * MOOSE_AD_MAX_DOFS_PER_ELEM / (number of nonlinear variables). Configure with a larger value
+ * when a problem has many variables or high order elements.
+ */
+#ifndef MOOSE_AD_MAX_DOFS_PER_ELEM
+#define MOOSE_AD_MAX_DOFS_PER_ELEM 64
+#endif
+
+typedef DualNumber<Real, MOOSE_AD_MAX_DOFS_PER_ELEM> ADReal;
+typedef VectorValue<ADReal> ADRealGradient;
+
+typedef MooseArray<ADReal> ADVariableValue;
+typedef MooseArray<ADRealGradient> ADVariableGradient;
+
+namespace Moose
+{
+/**
+ * The number of derivatives reserved for each nonlinear variable
+ * @param n_vars The number of nonlinear variables
+ */
+inline unsigned int
+adDofsPerVariable(unsigned int n_vars)
+{
+  return n_vars ? MOOSE_AD_MAX_DOFS_PER_ELEM / n_vars : MOOSE_AD_MAX_DOFS_PER_ELEM;
+}
+}
+
+#endif // ADREAL_H
@@ -63,6 +63,16 @@ public:
   Real sample2ndDerivative(
       Real x1, Real x2, unsigned int deriv_var, Real yp1 = _deriv_bound, Real ypn = _deriv_bound);
 
+  /**
+   * Samples the spline and its first derivatives wrt x1 and x2 in a single pass.
+   * With natural boundary conditions the spline is a bicubic polynomial on each
+   * grid cell, so the coefficients of every cell are computed once in solve() and
+   * sampling only requires locating the cell (in constant time for uniformly
+   * spaced data) and evaluating one polynomial. Falls back to sample() and
+   * sampleDerivative() if boundary derivatives have been supplied.
+   */
+  void sampleValueAndDerivatives(Real x1, Real x2, Real & y, Real & dy1, Real & dy2);
+
 protected:
   std::vector<Real> _x1;
   std::vector<Real> _x2;
@@ -87,8 +97,18 @@ protected:
 
   void constructRowSplineSecondDerivativeTable();
   void constructColumnSplineSecondDerivativeTable();
+  void constructCellCoefficients();
   void solve();
 
+  /// Index of the grid interval containing x_int (constant time if the grid is uniform)
+  unsigned int findCell(const std::vector<Real> & x, bool uniform, Real x_int) const;
+
+  /// Flags to indicate that the x1 and x2 grid points are uniformly spaced
+  bool _x1_uniform;
+  bool _x2_uniform;
+  /// Bicubic coefficients of each grid cell (16 per cell, empty if not all boundaries are natural)
+  std::vector<Real> _cell_coeffs;
+
   static int _file_number;
 };
 
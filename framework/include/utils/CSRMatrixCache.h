@@ -0,0 +1,92 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef CSRMATRIXCACHE_H
+#define CSRMATRIXCACHE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <vector>
+
+// Forward declarations
+namespace libMesh
+{
+template <typename T>
+class SparseMatrix;
+}
+
+/**
+ * Accumulates additions to the local rows of a PETSc matrix in a copy of its compressed row
+ * (CSR) sparsity pattern, so that they can be added with a single MatSetValues() call per row
+ * instead of one call per entry.  The pattern is copied from the assembled matrix by
+ * build(), entries outside of it (off-processor rows or new nonzeros) are added to the matrix
+ * directly by flush().
+ */
+class CSRMatrixCache
+{
+public:
+  CSRMatrixCache();
+
+  /**
+   * Copy the sparsity pattern of the local rows of the assembled \p matrix.  Nothing is stored
+   * if \p matrix is not an assembled PETSc matrix.
+   */
+  void build(SparseMatrix<Number> & matrix);
+
+  /// Discard the sparsity pattern, e.g. because the mesh changed
+  void clear();
+
+  /// Whether or not additions to \p matrix can be accumulated
+  bool valid(const SparseMatrix<Number> & matrix) const;
+
+  /// Add \p value to entry (\p row, \p col)
+  void add(dof_id_type row, dof_id_type col, Number value);
+
+  /// Add the accumulated values to \p matrix and zero them
+  void flush(SparseMatrix<Number> & matrix);
+
+  /// Discard the accumulated values, e.g. after an evaluation has been interrupted
+  void zero();
+
+protected:
+  /// The matrix the pattern was copied from
+  const SparseMatrix<Number> * _matrix;
+
+  /// The first local row and the number of local rows
+  dof_id_type _first_row;
+  dof_id_type _n_rows;
+
+  /// The sorted global columns of every local row: in [_row_start[r], _row_start[r + 1])
+  std::vector<dof_id_type> _row_start;
+  std::vector<dof_id_type> _cols;
+
+  /// The accumulated values, in the order of _cols
+  std::vector<Number> _values;
+
+  /// Whether or not anything was added to a row since the last flush()
+  std::vector<unsigned char> _row_touched;
+
+  /// Additions that are not part of the local pattern
+  std::vector<dof_id_type> _other_rows;
+  std::vector<dof_id_type> _other_cols;
+  std::vector<Number> _other_values;
+};
+
+#endif // CSRMATRIXCACHE_H
@@ -18,6 +18,7 @@
 // MOOSE includes
 #include "Moose.h"      // using namespace libMesh
 #include "MooseError.h" // mooseAssert
+#include "SmallMatrix.h"
 
 // libMesh includes
 #include "libmesh/type_tensor.h"
@@ -645,6 +646,21 @@ inline ColumnMajorMatrix ColumnMajorMatrix::operator*(const ColumnMajorMatrix &
 
   ColumnMajorMatrix ret_matrix(_n_rows, rhs._n_cols);
 
+  // Square matrices of the sizes the mechanics models use go to the fixed size kernels
+  if (_n_rows == _n_cols && rhs._n_rows == _n_cols && rhs._n_cols == _n_cols)
+    switch (_n_rows)
+    {
+      case 3:
+        SmallMatrix<3>::multiply(rawData(), rhs.rawData(), ret_matrix.rawData());
+        return ret_matrix;
+      case 6:
+        SmallMatrix<6>::multiply(rawData(), rhs.rawData(), ret_matrix.rawData());
+        return ret_matrix;
+      case 9:
+        SmallMatrix<9>::multiply(rawData(), rhs.rawData(), ret_matrix.rawData());
+        return ret_matrix;
+    }
+
   for (unsigned int i = 0; i < ret_matrix._n_rows; ++i)
     for (unsigned int j = 0; j < ret_matrix._n_cols; ++j)
       for (unsigned int k = 0; k < _n_cols; ++k)
@@ -36,6 +36,10 @@ namespace MooseUtils
  * This class assumes that all data is numeric and can be converted to a C++ double. If a
  * Communicator is provide then it will only read on processor 0 and broadcast the data to all
  * processors. If not provided it will read on all processors.
+ *
+ * The file is memory mapped and the rows are converted on all available threads. When the
+ * cache is enabled the parsed table is stored next to the file (<filename>.cache) and reused
+ * as long as the size and modification time of the file do not change.
  */
 class DelimitedFileReader
 {
@@ -62,6 +66,11 @@ public:
    */
   void setIgnoreEmptyLines(bool value) { _ignore_empty_lines = value; }
 
+  /**
+   * Toggle for reading and writing the binary table cache.
+   */
+  void setUseCache(bool value) { _use_cache = value; }
+
   /**
    * Return the columns of data.
    *
@@ -87,6 +96,9 @@ protected:
   /// Flag for ignoring empty lines
   bool _ignore_empty_lines;
 
+  /// Flag for reading and writing the binary table cache
+  bool _use_cache;
+
   /// Storage for the read or generated column names.
   std::vector<std::string> _column_names;
 
@@ -98,14 +110,25 @@ protected:
 
 private:
   /**
-   * Read or generate header names.
+   * Read or generate header names, a header line is consumed by advancing begin.
    */
-  void initializeColumns(std::ifstream & stream_data);
+  void initializeColumns(const char *& begin, const char * end);
 
   /**
    * Read the numeric data and return a single vector for broadcasting
    */
-  void readData(std::ifstream & stream_data, std::vector<double> & output);
+  void readData(const char * begin, const char * end, std::vector<double> & output);
+
+  /**
+   * Load the column names and data from the cache file, returns false if there is no cache that
+   * matches the current file.
+   */
+  bool readCache(const std::string & cache_name, std::vector<double> & output);
+
+  /**
+   * Store the column names and data in the cache file.
+   */
+  void writeCache(const std::string & cache_name, std::vector<double> & output);
 };
 }
 
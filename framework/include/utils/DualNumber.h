@@ -0,0 +1,317 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DUALNUMBER_H
+#define DUALNUMBER_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/compare_types.h"
+
+// C++ includes
+#include <array>
+#include <cmath>
+#include <ostream>
+
+/**
+ * A forward mode automatic differentiation number: a value together with its derivatives with
+ * respect to N independent variables, all of which are carried through every operation.
+ *
+ * The derivatives are stored on the stack, so N should be the smallest size that fits the
+ * degrees of freedom the number depends on (see ADReal.h).
+ */
+template <typename T, unsigned int N>
+class DualNumber
+{
+public:
+  typedef T value_type;
+  typedef std::array<T, N> derivatives_type;
+
+  DualNumber() : _value(0) { _derivatives.fill(0); }
+
+  /// A constant, all derivatives are zero
+  DualNumber(const T & value) : _value(value) { _derivatives.fill(0); }
+
+  DualNumber(const T & value, const derivatives_type & derivatives)
+    : _value(value), _derivatives(derivatives)
+  {
+  }
+
+  /// The derivative size
+  static constexpr unsigned int size() { return N; }
+
+  const T & value() const { return _value; }
+  T & value() { return _value; }
+
+  const derivatives_type & derivatives() const { return _derivatives; }
+  derivatives_type & derivatives() { return _derivatives; }
+
+  DualNumber operator-() const
+  {
+    DualNumber result(-_value);
+    for (unsigned int i = 0; i < N; ++i)
+      result._derivatives[i] = -_derivatives[i];
+    return result;
+  }
+
+  DualNumber & operator+=(const DualNumber & b)
+  {
+    _value += b._value;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] += b._derivatives[i];
+    return *this;
+  }
+
+  DualNumber & operator-=(const DualNumber & b)
+  {
+    _value -= b._value;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] -= b._derivatives[i];
+    return *this;
+  }
+
+  DualNumber & operator*=(const DualNumber & b)
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] = _derivatives[i] * b._value + _value * b._derivatives[i];
+    _value *= b._value;
+    return *this;
+  }
+
+  DualNumber & operator/=(const DualNumber & b)
+  {
+    const T inv = 1 / b._value;
+    const T ratio = _value * inv;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] = (_derivatives[i] - ratio * b._derivatives[i]) * inv;
+    _value = ratio;
+    return *this;
+  }
+
+  DualNumber & operator+=(const T & b)
+  {
+    _value += b;
+    return *this;
+  }
+
+  DualNumber & operator-=(const T & b)
+  {
+    _value -= b;
+    return *this;
+  }
+
+  DualNumber & operator*=(const T & b)
+  {
+    _value *= b;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] *= b;
+    return *this;
+  }
+
+  DualNumber & operator/=(const T & b)
+  {
+    const T inv = 1 / b;
+    _value *= inv;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] *= inv;
+    return *this;
+  }
+
+  /**
+   * Applies the chain rule for a function f evaluated at value(): returns the number with the
+   * value f and the derivatives df * derivatives()
+   */
+  DualNumber chain(const T & f, const T & df) const
+  {
+    DualNumber result(f);
+    for (unsigned int i = 0; i < N; ++i)
+      result._derivatives[i] = df * _derivatives[i];
+    return result;
+  }
+
+private:
+  T _value;
+  derivatives_type _derivatives;
+};
+
+// The scalar arguments are taken as value_type so that they are not used to deduce T, which
+// lets integer and double literals mix with DualNumber<Real, N>.
+
+#define DUALNUMBER_BINARY_OPERATOR(op)                                                             \
+  template <typename T, unsigned int N>                                                            \
+  inline DualNumber<T, N> operator op(const DualNumber<T, N> & a, const DualNumber<T, N> & b)     \
+  {                                                                                                \
+    DualNumber<T, N> result(a);                                                                    \
+    return result op## = b;                                                                        \
+  }                                                                                                \
+  template <typename T, unsigned int N>                                                            \
+  inline DualNumber<T, N> operator op(const DualNumber<T, N> & a,                                 \
+                                      const typename DualNumber<T, N>::value_type & b)             \
+  {                                                                                                \
+    DualNumber<T, N> result(a);                                                                    \
+    return result op## = b;                                                                        \
+  }                                                                                                \
+  template <typename T, unsigned int N>                                                            \
+  inline DualNumber<T, N> operator op(const typename DualNumber<T, N>::value_type & a,            \
+                                      const DualNumber<T, N> & b)                                  \
+  {                                                                                                \
+    DualNumber<T, N> result(a);                                                                    \
+    return result op## = b;                                                                        \
+  }
+
+DUALNUMBER_BINARY_OPERATOR(+)
+DUALNUMBER_BINARY_OPERATOR(-)
+DUALNUMBER_BINARY_OPERATOR(*)
+DUALNUMBER_BINARY_OPERATOR(/)
+
+#undef DUALNUMBER_BINARY_OPERATOR
+
+// Comparisons only look at the values
+#define DUALNUMBER_COMPARISON(op)                                                                  \
+  template <typename T, unsigned int N>                                                            \
+  inline bool operator op(const DualNumber<T, N> & a, const DualNumber<T, N> & b)                 \
+  {                                                                                                \
+    return a.value() op b.value();                                                                 \
+  }                                                                                                \
+  template <typename T, unsigned int N>                                                            \
+  inline bool operator op(const DualNumber<T, N> & a,                                             \
+                          const typename DualNumber<T, N>::value_type & b)                         \
+  {                                                                                                \
+    return a.value() op b;                                                                         \
+  }                                                                                                \
+  template <typename T, unsigned int N>                                                            \
+  inline bool operator op(const typename DualNumber<T, N>::value_type & a,                        \
+                          const DualNumber<T, N> & b)                                              \
+  {                                                                                                \
+    return a op b.value();                                                                         \
+  }
+
+DUALNUMBER_COMPARISON(<)
+DUALNUMBER_COMPARISON(<=)
+DUALNUMBER_COMPARISON(>)
+DUALNUMBER_COMPARISON(>=)
+DUALNUMBER_COMPARISON(==)
+DUALNUMBER_COMPARISON(!=)
+
+#undef DUALNUMBER_COMPARISON
+
+template <typename T, unsigned int N>
+inline std::ostream &
+operator<<(std::ostream & os, const DualNumber<T, N> & a)
+{
+  return os << a.value();
+}
+
+// The math functions live in std (alongside the overloads for the builtin types) so that
+// qualified calls like std::sqrt, which libMesh's TypeVector makes as well, find them.
+namespace std
+{
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+sqrt(const DualNumber<T, N> & a)
+{
+  const T f = std::sqrt(a.value());
+  return a.chain(f, 0.5 / f);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+exp(const DualNumber<T, N> & a)
+{
+  const T f = std::exp(a.value());
+  return a.chain(f, f);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+log(const DualNumber<T, N> & a)
+{
+  return a.chain(std::log(a.value()), 1 / a.value());
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+pow(const DualNumber<T, N> & a, const typename DualNumber<T, N>::value_type & b)
+{
+  return a.chain(std::pow(a.value(), b), b * std::pow(a.value(), b - 1));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+pow(const DualNumber<T, N> & a, const DualNumber<T, N> & b)
+{
+  // d(a^b) = a^b (b' log(a) + b a' / a)
+  return std::exp(b * std::log(a));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+sin(const DualNumber<T, N> & a)
+{
+  return a.chain(std::sin(a.value()), std::cos(a.value()));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+cos(const DualNumber<T, N> & a)
+{
+  return a.chain(std::cos(a.value()), -std::sin(a.value()));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+tanh(const DualNumber<T, N> & a)
+{
+  const T f = std::tanh(a.value());
+  return a.chain(f, 1 - f * f);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+abs(const DualNumber<T, N> & a)
+{
+  return a.value() < 0 ? -a : a;
+}
+
+} // namespace std
+
+namespace libMesh
+{
+
+// Let TypeVector and TypeTensor hold dual numbers and mix them with their Real counterparts
+
+template <typename T, unsigned int N>
+struct ScalarTraits<DualNumber<T, N>>
+{
+  static const bool value = ScalarTraits<T>::value;
+};
+
+template <typename T, unsigned int N>
+struct CompareTypes<DualNumber<T, N>, T>
+{
+  typedef DualNumber<T, N> supertype;
+};
+
+template <typename T, unsigned int N>
+struct CompareTypes<T, DualNumber<T, N>>
+{
+  typedef DualNumber<T, N> supertype;
+};
+
+} // namespace libMesh
+
+#endif // DUALNUMBER_H
@@ -0,0 +1,89 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EVALUATIONCOUNTERS_H
+#define EVALUATIONCOUNTERS_H
+
+#include "MooseTypes.h"
+
+// C++ includes
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Named counters for the evaluations performed by a problem (materials, auxiliary kernels per
+ * execution flag, geometric search updates, user objects, ...), used to spot work that is repeated
+ * more often than needed.
+ *
+ * The names are registered once per process, usually as a static local, while every
+ * FEProblemBase keeps its own counts so that the applications of a MultiApp are counted apart:
+ *
+ *   static const EvaluationCounters::CounterID counter =
+ *       EvaluationCounters::registerCounter("geometric search updates");
+ *   _evaluation_counters.increment(counter);
+ *
+ * Each thread increments its own array, so increments inside the threaded loops need no locking;
+ * the arrays must be sized for the threads with initThreads() before the loops run.
+ */
+class EvaluationCounters
+{
+public:
+  typedef unsigned int CounterID;
+
+  EvaluationCounters();
+
+  /**
+   * Register a counter, registering an existing name returns the id of that counter.
+   * This method is thread safe.
+   */
+  static CounterID registerCounter(const std::string & name);
+
+  /// The names of the registered counters, in registration order
+  static std::vector<std::string> names();
+
+  /// Size the per thread counts, must be called outside of the threaded loops
+  void initThreads(THREAD_ID n_threads);
+
+  /// Add to a counter on the given thread
+  void increment(CounterID id, THREAD_ID tid = 0, unsigned long int amount = 1)
+  {
+    auto & counts = _counts[tid];
+    if (id >= counts.size())
+      counts.resize(id + 1);
+    counts[id] += amount;
+  }
+
+  /// The count of this processor summed over the threads, zero for an unknown name
+  unsigned long int count(const std::string & name) const;
+
+  /// Reset every counter
+  void clear();
+
+private:
+  /// The registered names and their ids, shared by all problems
+  struct Registry
+  {
+    std::mutex mutex;
+    std::map<std::string, CounterID> ids;
+    std::vector<std::string> names;
+  };
+  static Registry & registry();
+
+  /// The counts of each thread, indexed by id
+  std::vector<std::vector<unsigned long int>> _counts;
+};
+
+#endif // EVALUATIONCOUNTERS_H
@@ -22,6 +22,7 @@
 
 // C++ includes
 #include <fstream>
+#include <limits>
 
 // Forward declarations
 class FormattedTable;
@@ -116,6 +117,20 @@ public:
    */
   void sortColumns();
 
+  /**
+   * Enables the append only mode of printCSV(): only the rows added since the previous call are
+   * appended to the file and afterwards only the last rows are kept in memory.  The columns can
+   * not change once the header is written and rows already written are not updated.
+   * @param tail_rows The number of rows kept in memory (at least one row is kept)
+   */
+  void appendOnly(unsigned int tail_rows);
+
+  /**
+   * Removes all but the last rows of the table from memory
+   * @param tail_rows The number of rows kept (at least one row is kept)
+   */
+  void trim(unsigned int tail_rows);
+
 protected:
   void printTablePiece(std::ostream & out,
                        unsigned int last_n_entries,
@@ -168,6 +183,9 @@ private:
   /// idempotent.
   void open(const std::string & file_name);
 
+  /// The append only version of printCSV()
+  void appendCSV(const std::string & file_name, int interval, bool align);
+
   /// The optional output file stream
   std::string _output_file_name;
   std::ofstream _output_file;
@@ -188,6 +206,19 @@ private:
   /// Flag indicating that sorting is necessary (used by sortColumns method).
   bool _column_names_unsorted = true;
 
+  /// The number of rows kept in memory by the append only mode, zero if the mode is disabled
+  unsigned int _append_tail_rows = 0;
+
+  /// The columns of the header written by the append only mode
+  std::vector<std::string> _append_columns;
+
+  /// The key of the last row written by the append only mode
+  Real _append_last_key = -std::numeric_limits<Real>::max();
+
+  /// The number of rows considered for writing and the size of the file, for the append only mode
+  unsigned long long _append_rows = 0;
+  unsigned long long _append_size = 0;
+
   friend void
   dataStore<FormattedTable>(std::ostream & stream, FormattedTable & table, void * context);
   friend void dataLoad<FormattedTable>(std::istream & stream, FormattedTable & v, void * context);
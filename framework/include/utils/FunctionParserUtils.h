@@ -51,11 +51,38 @@ protected:
   /// Evaluate FParser object and check EvalError
   Real evaluate(ADFunctionPtr &);
 
+  /// Evaluate FParser object for the given parameter array and check EvalError
+  Real evaluate(ADFunctionPtr &, const Real * params);
+
+  /**
+   * Evaluate FParser object for a batch of parameter sets and check EvalError. The parameter sets
+   * are stored back to back in params, each with n_params values. Evaluating one parser object for
+   * all points in a row keeps its byte code (or compiled code) hot instead of looping over all
+   * parser objects for every point.
+   * @param results destination indexed by point, must hold params.size() / n_params values
+   */
+  template <typename T>
+  void evaluateBatch(ADFunctionPtr & parser,
+                     const std::vector<Real> & params,
+                     unsigned int n_params,
+                     T & results);
+
   /// add constants (which can be complex expressions) to the parser object
   void addFParserConstants(ADFunctionPtr & parser,
                            const std::vector<std::string> & constant_names,
                            const std::vector<std::string> & constant_expressions);
 
+  /**
+   * Look up a parser object in the process wide cache of optimized and compiled functions. Objects
+   * building identical expressions (on other blocks or threads) share the work this way. Returns a
+   * copy of the cached parser object, or nullptr if the key is not cached yet.
+   * @param key canonical description of the expression, the feature flags are appended internally
+   */
+  ADFunctionPtr getCachedFunction(const std::string & key) const;
+
+  /// store a copy of a fully optimized (and compiled) parser object in the cache
+  void cacheFunction(const std::string & key, const ADFunctionPtr & parser) const;
+
   //@{ feature flags
   bool _enable_jit;
   bool _enable_ad_cache;
@@ -72,6 +99,31 @@ protected:
 
   /// Array to stage the parameters passed to the functions when calling Eval.
   std::vector<Real> _func_params;
+
+private:
+  /// cache key including the feature flags that change the processed parser object
+  std::string functionCacheKey(const std::string & key) const;
 };
 
+template <typename T>
+void
+FunctionParserUtils::evaluateBatch(ADFunctionPtr & parser,
+                                   const std::vector<Real> & params,
+                                   unsigned int n_params,
+                                   T & results)
+{
+  const std::size_t n_points = n_params ? params.size() / n_params : 0;
+
+  // null pointer is a shortcut for vanishing derivatives, see functionsOptimize()
+  if (parser == NULL)
+  {
+    for (std::size_t p = 0; p < n_points; ++p)
+      results[p] = 0.0;
+    return;
+  }
+
+  for (std::size_t p = 0; p < n_points; ++p)
+    results[p] = evaluate(parser, params.data() + p * n_params);
+}
+
 #endif // FUNCTIONPARSERUTILS_H
@@ -0,0 +1,180 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef HARDWARECOUNTERS_H
+#define HARDWARECOUNTERS_H
+
+#include "MooseTypes.h"
+
+// C++ includes
+#include <array>
+#include <map>
+#include <ostream>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+namespace Parallel
+{
+class Communicator;
+}
+}
+
+/**
+ * Hardware performance counters (cycles, instructions, cache references and cache misses)
+ * sampled around the threaded element loops, per loop and per subdomain.
+ *
+ * The counters are read through the Linux perf_event interface, so they count the calling
+ * thread only and need no external library.  Each thread opens its counters the first time it
+ * samples and keeps them running; a sample is the difference of two group reads, taken when a
+ * loop enters a subdomain and when it leaves it.  Counts are scaled when the kernel had to
+ * multiplex the counters.  On other platforms, or where the kernel does not allow user space
+ * counting (see /proc/sys/kernel/perf_event_paranoid), enable() reports that the counters are
+ * unavailable and nothing is sampled.
+ */
+class HardwareCounters
+{
+public:
+  /// The counted events
+  enum Event
+  {
+    CYCLES = 0,
+    INSTRUCTIONS,
+    CACHE_REFERENCES,
+    CACHE_MISSES,
+    NUM_EVENTS
+  };
+
+  typedef std::array<unsigned long long int, NUM_EVENTS> Values;
+
+  /// The events accumulated by one loop on one subdomain
+  struct Counts
+  {
+    /// The number of samples (loop chunks entering the subdomain)
+    unsigned long int samples = 0;
+    Values values = Values();
+  };
+
+  /// The counts of one loop on one subdomain, summed over all threads and processors
+  struct Record
+  {
+    std::string loop;
+    SubdomainID subdomain;
+    Counts counts;
+  };
+
+  HardwareCounters();
+
+  /**
+   * Enable the sampling, must be called outside of the threaded loops as it sizes the per thread
+   * tables.  Prints a message and leaves the sampling disabled if the counters can not be
+   * opened.
+   */
+  void enable();
+  bool enabled() const { return _enabled; }
+
+  /// Reset the accumulated values
+  void clear();
+
+  /**
+   * Read the counters of the calling thread, opening them on the first call.
+   * @return false if the counters are not available
+   */
+  static bool read(Values & values);
+
+  /// The counts of a loop on a subdomain on the given thread
+  Counts & counts(const std::type_info & loop, SubdomainID subdomain, THREAD_ID tid)
+  {
+    return _thread_counts[tid][std::make_pair(std::type_index(loop), subdomain)];
+  }
+
+  /**
+   * The counts of this processor summed over the threads for the loop with the given (class)
+   * name on the given subdomain.  An empty \p loop sums all loops and Moose::ANY_BLOCK_ID sums
+   * all subdomains.
+   */
+  Counts localData(const std::string & loop, SubdomainID subdomain) const;
+
+  /**
+   * The records of all loops sampled on any processor, sorted by loop and subdomain.
+   * This method is collective on the communicator.
+   */
+  std::vector<Record> records(const Parallel::Communicator & comm) const;
+
+  /// Print the records as a table with the derived ratios, collective on the communicator
+  void print(std::ostream & os, const Parallel::Communicator & comm) const;
+
+  /// The name of a counted event
+  static const std::string & eventName(Event event);
+
+private:
+  typedef std::map<std::pair<std::type_index, SubdomainID>, Counts> CountsMap;
+
+  bool _enabled;
+
+  /// Whether opening the counters failed, so that the failure is only reported once
+  bool _unavailable;
+
+  /// The counts of each thread
+  std::vector<CountsMap> _thread_counts;
+};
+
+/**
+ * Adds the events counted from the last start() to the counts of a loop on a subdomain:
+ *
+ *   HardwareCounterSample sample(Moose::hardware_counters);
+ *   ...
+ *   if (_subdomain != _old_subdomain)
+ *     sample.start(typeid(*this), _subdomain, _tid);
+ *
+ * start() ends the running sample, the destructor ends the last one.  While the counters are
+ * disabled the guard only tests a flag.
+ */
+class HardwareCounterSample
+{
+public:
+  HardwareCounterSample(HardwareCounters & counters) : _counters(counters), _current(nullptr) {}
+
+  ~HardwareCounterSample() { stop(); }
+
+  void start(const std::type_info & loop, SubdomainID subdomain, THREAD_ID tid)
+  {
+    if (!_counters.enabled())
+      return;
+
+    stop();
+    if (HardwareCounters::read(_start))
+      _current = &_counters.counts(loop, subdomain, tid);
+  }
+
+  void stop();
+
+  HardwareCounterSample(const HardwareCounterSample &) = delete;
+  HardwareCounterSample & operator=(const HardwareCounterSample &) = delete;
+
+private:
+  HardwareCounters & _counters;
+
+  /// The counts the running sample is added to, nullptr when no sample is running
+  HardwareCounters::Counts * _current;
+
+  /// The counter values when the running sample started
+  HardwareCounters::Values _start;
+};
+
+#endif // HARDWARECOUNTERS_H
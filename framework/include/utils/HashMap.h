@@ -12,29 +12,196 @@
 /*            See COPYRIGHT for full restrictions               */
 /****************************************************************/
 
+
 #ifndef HASHMAP_H
 #define HASHMAP_H
 
-/// HashMap is an abstraction for dictionary data type, we make it thread-safe by locking inserts
 #include "libmesh/threads.h"
 
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <unordered_map>
 
+/**
+ * HashMap is an abstraction for dictionary data type that is safe to insert into from
+ * multiple threads.  The keys are spread over a fixed number of independently locked
+ * shards, so threads inserting different keys rarely wait on each other.  References to
+ * stored values are never invalidated by inserts.
+ *
+ * Iterating, clear() and reserve() are not thread-safe.
+ */
 template <typename Key, typename T>
-class HashMap : public std::unordered_map<Key, T>
+class HashMap
 {
 public:
+  typedef std::unordered_map<Key, T> Shard;
+  typedef typename Shard::value_type value_type;
+
+  /// The number of independently locked shards
+  static const unsigned int n_shards = 32;
+
+  /**
+   * Forward iterator visiting the entries of every shard in turn.
+   */
+  template <typename MapType, typename ShardIterator, typename Value>
+  class Iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Value * pointer;
+    typedef Value & reference;
+
+    Iterator(MapType & map, unsigned int shard, ShardIterator it)
+      : _map(&map), _shard(shard), _it(it)
+    {
+      skipEmpty();
+    }
+
+    Value & operator*() const { return *_it; }
+    Value * operator->() const { return &(*_it); }
+
+    Iterator & operator++()
+    {
+      ++_it;
+      skipEmpty();
+      return *this;
+    }
+
+    Iterator operator++(int)
+    {
+      Iterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const Iterator & other) const
+    {
+      return _shard == other._shard && (_shard == n_shards || _it == other._it);
+    }
+    bool operator!=(const Iterator & other) const { return !(*this == other); }
+
+  private:
+    /// Move on to the next non-empty shard if we've reached the end of this one
+    void skipEmpty()
+    {
+      while (_shard < n_shards && _it == _map->_shards[_shard].end())
+        if (++_shard < n_shards)
+          _it = _map->_shards[_shard].begin();
+    }
+
+    MapType * _map;
+    unsigned int _shard;
+    ShardIterator _it;
+  };
+
+  typedef Iterator<HashMap, typename Shard::iterator, value_type> iterator;
+  typedef Iterator<const HashMap, typename Shard::const_iterator, const value_type> const_iterator;
+
+  HashMap() = default;
+
+  HashMap(const HashMap &) = delete;
+  HashMap & operator=(const HashMap &) = delete;
+
   inline T & operator[](const Key & k)
   {
-    libMesh::Threads::spin_mutex::scoped_lock lock(spin_mutex);
+    const unsigned int s = shardIndex(k);
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutexes[s]);
+
+    return _shards[s][k];
+  }
+
+  /**
+   * Return the value stored for \p k.  If \p k was not present, the value is
+   * default-constructed and then passed to \p init while the shard is still locked, so
+   * no other thread can see the value before it is initialized.
+   */
+  template <typename Init>
+  inline T & findOrInsert(const Key & k, Init init)
+  {
+    const unsigned int s = shardIndex(k);
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutexes[s]);
+
+    auto result = _shards[s].emplace(k, T());
+    if (result.second)
+      init(result.first->second);
+
+    return result.first->second;
+  }
+
+  inline iterator find(const Key & k)
+  {
+    const unsigned int s = shardIndex(k);
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutexes[s]);
+
+    auto it = _shards[s].find(k);
+    return it == _shards[s].end() ? end() : iterator(*this, s, it);
+  }
+
+  inline const_iterator find(const Key & k) const
+  {
+    const unsigned int s = shardIndex(k);
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutexes[s]);
+
+    auto it = _shards[s].find(k);
+    return it == _shards[s].end() ? end() : const_iterator(*this, s, it);
+  }
+
+  inline bool contains(const Key & key) const { return find(key) != end(); }
+
+  iterator begin() { return iterator(*this, 0, _shards[0].begin()); }
+  iterator end() { return iterator(*this, n_shards, _shards[n_shards - 1].end()); }
+  const_iterator begin() const { return const_iterator(*this, 0, _shards[0].begin()); }
+  const_iterator end() const
+  {
+    return const_iterator(*this, n_shards, _shards[n_shards - 1].end());
+  }
 
-    return std::unordered_map<Key, T>::operator[](k);
+  std::size_t size() const
+  {
+    std::size_t n = 0;
+    for (const auto & shard : _shards)
+      n += shard.size();
+    return n;
   }
 
-  inline bool contains(const Key & key) { return this->find(key) != this->end(); }
+  bool empty() const { return size() == 0; }
+
+  void clear()
+  {
+    for (auto & shard : _shards)
+      shard.clear();
+  }
+
+  /**
+   * Reserve space for \p n entries so that threads inserting up to that many keys
+   * never trigger a rehash.
+   */
+  void reserve(std::size_t n)
+  {
+    for (auto & shard : _shards)
+      shard.reserve(n / n_shards + 1);
+  }
 
 private:
-  libMesh::Threads::spin_mutex spin_mutex;
+  /// The shard holding \p k.  The hash is mixed since pointer hashes have empty low bits.
+  static unsigned int shardIndex(const Key & k)
+  {
+    std::size_t h = std::hash<Key>()(k);
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+    return h % n_shards;
+  }
+
+  std::array<Shard, n_shards> _shards;
+  mutable std::array<libMesh::Threads::spin_mutex, n_shards> _mutexes;
 };
 
+template <typename Key, typename T>
+const unsigned int HashMap<Key, T>::n_shards;
+
 #endif /* HASHMAP_H */
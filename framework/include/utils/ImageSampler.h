@@ -104,6 +104,20 @@ protected:
    */
   void vtkFlip();
 
+  /**
+   * Copy the filtered image into the native voxel store, cropped to the local mesh if requested,
+   * and release the VTK image data
+   */
+  void buildVoxelStore(MooseMesh & mesh);
+
+  /**
+   * Return a stored voxel value, the indices are relative to the cropped region
+   */
+  Real voxel(int i, int j, int k) const
+  {
+    return _voxels[(static_cast<std::size_t>(k) * _voxel_count[1] + j) * _voxel_count[0] + i];
+  }
+
 private:
 #ifdef LIBMESH_HAVE_VTK
 
@@ -161,6 +175,27 @@ private:
   /// Bounding box for testing points
   MeshTools::BoundingBox _bounding_box;
 
+  /// Whether to interpolate between voxel centers rather than returning the nearest voxel
+  const bool _trilinear;
+
+  /// Whether only the voxels near the local elements are stored
+  const bool _crop_to_local_mesh;
+
+  /// Filtered voxel values (x fastest), restricted to [_voxel_begin, _voxel_end)
+  std::vector<Real> _voxels;
+
+  /// First stored voxel index in each direction
+  int _voxel_begin[3];
+
+  /// One past the last stored voxel index in each direction
+  int _voxel_end[3];
+
+  /// Number of stored voxels in each direction
+  int _voxel_count[3];
+
+  /// Inverse of the voxel size, zero for directions without extent
+  Real _inv_voxel[3];
+
   /// Parameters for interface
   const InputParameters & _is_pars;
 
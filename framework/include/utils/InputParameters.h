@@ -33,6 +33,9 @@ class FunctionParserBase
 };
 #endif
 
+// C++ includes
+#include <memory>
+
 // Forward declarations
 class Action;
 class InputParameters;
@@ -683,23 +686,46 @@ private:
   template <typename T, typename S>
   void setParamHelper(const std::string & name, T & l_value, const S & r_value);
 
-  /// The documentation strings for each parameter
-  std::map<std::string, std::string> _doc_string;
+  /**
+   * Descriptive parameter information that is (almost) never changed once the validParams
+   * function of an object has run. Copies of an InputParameters object share a single instance
+   * of this data, it is only duplicated when one of the copies modifies it.
+   */
+  struct Metadata
+  {
+    /// The documentation strings for each parameter
+    std::map<std::string, std::string> doc_string;
+
+    /// The custom type that will be printed in the YAML dump for a parameter if supplied
+    std::map<std::string, std::string> custom_type;
+
+    /// Syntax for command-line parameters
+    std::map<std::string, std::vector<std::string>> syntax;
 
-  /// The custom type that will be printed in the YAML dump for a parameter if supplied
-  std::map<std::string, std::string> _custom_type;
+    /// The names of the parameters organized into groups
+    std::map<std::string, std::string> group;
 
-  /// Syntax for command-line parameters
-  std::map<std::string, std::vector<std::string>> _syntax;
+    /// The map of functions used for range checked parameters
+    std::map<std::string, std::string> range_functions;
 
-  /// The names of the parameters organized into groups
-  std::map<std::string, std::string> _group;
+    /// The map of auto build vectors (base_, 5 -> "base_0 base_1 base_2 base_3 base_4")
+    std::map<std::string, std::pair<std::string, std::string>> auto_build_vectors;
 
-  /// The map of functions used for range checked parameters
-  std::map<std::string, std::string> _range_functions;
+    /// The list of deprecated params
+    std::map<std::string, std::string> deprecated_params;
 
-  /// The map of auto build vectors (base_, 5 -> "base_0 base_1 base_2 base_3 base_4")
-  std::map<std::string, std::pair<std::string, std::string>> _auto_build_vectors;
+    /// The reserved option names for a parameter
+    std::map<std::string, std::set<std::string>> reserved_values;
+  };
+
+  /// Read access to the (possibly shared) parameter metadata
+  const Metadata & metadata() const { return *_metadata; }
+
+  /// Write access to the parameter metadata, this detaches it from any other copies first
+  Metadata & writableMetadata();
+
+  /// The parameter metadata shared with copies of this object
+  std::shared_ptr<Metadata> _metadata;
 
   /// The parameter is used to restrict types that can be built.  Typically this
   /// is used for MooseObjectAction derived Actions.
@@ -728,9 +754,6 @@ private:
   /// The coupled variables set
   std::set<std::string> _coupled_vars;
 
-  /// The list of deprecated params
-  std::map<std::string, std::string> _deprecated_params;
-
   /// The default value for optionally coupled variables
   std::map<std::string, Real> _default_coupled_value;
 
@@ -743,9 +766,6 @@ private:
   /// A list of parameters declared as controllable
   std::set<std::string> _controllable_params;
 
-  /// The reserved option names for a parameter
-  std::map<std::string, std::set<std::string>> _reserved_values;
-
   /// Flag for disabling deprecated parameters message, this is used by applyParameters to avoid dumping messages
   bool _show_deprecated_message;
 
@@ -789,7 +809,7 @@ InputParameters::rangeCheck(const std::string & full_name,
 {
   mooseAssert(param, "Parameter is NULL");
 
-  if (_range_functions.count(short_name) == 0 || !isParamValid(short_name))
+  if (metadata().range_functions.count(short_name) == 0 || !isParamValid(short_name))
     return;
 
   /**
@@ -805,9 +825,10 @@ InputParameters::rangeCheck(const std::string & full_name,
    */
   FunctionParserBase<UP_T> fp;
   std::vector<std::string> vars;
-  if (fp.ParseAndDeduceVariables(_range_functions[short_name], vars) != -1) // -1 for success
+  if (fp.ParseAndDeduceVariables(metadata().range_functions.at(short_name), vars) !=
+      -1) // -1 for success
   {
-    oss << "Error parsing expression: " << _range_functions[short_name] << '\n';
+    oss << "Error parsing expression: " << metadata().range_functions.at(short_name) << '\n';
     return;
   }
 
@@ -829,7 +850,8 @@ InputParameters::rangeCheck(const std::string & full_name,
       {
         if (value.size() == 0)
         {
-          oss << "Range checking empty vector: " << _range_functions[short_name] << '\n';
+          oss << "Range checking empty vector: " << metadata().range_functions.at(short_name)
+              << '\n';
           return;
         }
 
@@ -842,7 +864,7 @@ InputParameters::rangeCheck(const std::string & full_name,
       {
         if (vars[j].substr(0, short_name.size() + 1) != short_name + "_")
         {
-          oss << "Error parsing expression: " << _range_functions[short_name] << '\n';
+          oss << "Error parsing expression: " << metadata().range_functions.at(short_name) << '\n';
           return;
         }
         std::istringstream iss(vars[j]);
@@ -853,7 +875,7 @@ InputParameters::rangeCheck(const std::string & full_name,
         {
           if (index >= value.size())
           {
-            oss << "Error parsing expression: " << _range_functions[short_name]
+            oss << "Error parsing expression: " << metadata().range_functions.at(short_name)
                 << "\nOut of range variable " << vars[j] << '\n';
             return;
           }
@@ -861,7 +883,7 @@ InputParameters::rangeCheck(const std::string & full_name,
         }
         else
         {
-          oss << "Error parsing expression: " << _range_functions[short_name]
+          oss << "Error parsing expression: " << metadata().range_functions.at(short_name)
               << "\nInvalid variable " << vars[j] << '\n';
           return;
         }
@@ -878,14 +900,14 @@ InputParameters::rangeCheck(const std::string & full_name,
     // test function using the parameters determined above
     if (fp.EvalError())
     {
-      oss << "Error evaluating expression: " << _range_functions[short_name] << '\n';
+      oss << "Error evaluating expression: " << metadata().range_functions.at(short_name) << '\n';
       return;
     }
 
     if (!result)
     {
       oss << "Range check failed for parameter " << full_name
-          << "\n\tExpression: " << _range_functions[short_name] << "\n";
+          << "\n\tExpression: " << metadata().range_functions.at(short_name) << "\n";
       if (need_to_iterate)
         oss << "\t Component: " << i << '\n';
     }
@@ -902,14 +924,15 @@ InputParameters::rangeCheck(const std::string & full_name,
 {
   mooseAssert(param, "Parameter is NULL");
 
-  if (_range_functions.find(short_name) == _range_functions.end() || !isParamValid(short_name))
+  if (metadata().range_functions.find(short_name) == metadata().range_functions.end() ||
+      !isParamValid(short_name))
     return;
 
   // Parse the expression
   FunctionParserBase<UP_T> fp;
-  if (fp.Parse(_range_functions[short_name], short_name) != -1) // -1 for success
+  if (fp.Parse(metadata().range_functions.at(short_name), short_name) != -1) // -1 for success
   {
-    oss << "Error parsing expression: " << _range_functions[short_name] << '\n';
+    oss << "Error parsing expression: " << metadata().range_functions.at(short_name) << '\n';
     return;
   }
 
@@ -924,14 +947,15 @@ InputParameters::rangeCheck(const std::string & full_name,
 
   if (fp.EvalError())
   {
-    oss << "Error evaluating expression: " << _range_functions[short_name]
+    oss << "Error evaluating expression: " << metadata().range_functions.at(short_name)
         << "\nPerhaps you used the wrong variable name?\n";
     return;
   }
 
   if (!result)
     oss << "Range check failed for parameter " << full_name
-        << "\n\tExpression: " << _range_functions[short_name] << "\n\tValue: " << value[0] << '\n';
+        << "\n\tExpression: " << metadata().range_functions.at(short_name)
+        << "\n\tValue: " << value[0] << '\n';
 }
 
 template <typename T>
@@ -957,7 +981,7 @@ InputParameters::addRequiredParam(const std::string & name, const std::string &
 
   InputParameters::insert<T>(name);
   _required_params.insert(name);
-  _doc_string[name] = doc_string;
+  writableMetadata().doc_string[name] = doc_string;
 }
 
 template <typename T>
@@ -978,7 +1002,7 @@ InputParameters::addParam(const std::string & name, const S & value, const std::
   checkConsistentType<T>(name);
 
   T & l_value = InputParameters::set<T>(name);
-  _doc_string[name] = doc_string;
+  writableMetadata().doc_string[name] = doc_string;
 
   // Set the parameter now
   setParamHelper(name, l_value, value);
@@ -997,7 +1021,7 @@ InputParameters::addParam(const std::string & name, const std::string & doc_stri
   checkConsistentType<T>(name);
 
   InputParameters::insert<T>(name);
-  _doc_string[name] = doc_string;
+  writableMetadata().doc_string[name] = doc_string;
 }
 
 template <typename T, typename S>
@@ -1014,7 +1038,7 @@ InputParameters::addRequiredRangeCheckedParam(const std::string & name,
                                               const std::string & doc_string)
 {
   addRequiredParam<T>(name, doc_string);
-  _range_functions[name] = parsed_function;
+  writableMetadata().range_functions[name] = parsed_function;
 }
 
 template <typename T>
@@ -1025,7 +1049,7 @@ InputParameters::addRangeCheckedParam(const std::string & name,
                                       const std::string & doc_string)
 {
   addParam<T>(name, value, doc_string);
-  _range_functions[name] = parsed_function;
+  writableMetadata().range_functions[name] = parsed_function;
 }
 
 template <typename T>
@@ -1035,7 +1059,7 @@ InputParameters::addRangeCheckedParam(const std::string & name,
                                       const std::string & doc_string)
 {
   addParam<T>(name, doc_string);
-  _range_functions[name] = parsed_function;
+  writableMetadata().range_functions[name] = parsed_function;
 }
 
 template <typename T>
@@ -1045,7 +1069,7 @@ InputParameters::addRequiredCustomTypeParam(const std::string & name,
                                             const std::string & doc_string)
 {
   addRequiredParam<T>(name, doc_string);
-  _custom_type[name] = custom_type;
+  writableMetadata().custom_type[name] = custom_type;
 }
 
 template <typename T>
@@ -1056,7 +1080,7 @@ InputParameters::addCustomTypeParam(const std::string & name,
                                     const std::string & doc_string)
 {
   addParam<T>(name, value, doc_string);
-  _custom_type[name] = custom_type;
+  writableMetadata().custom_type[name] = custom_type;
 }
 
 template <typename T>
@@ -1066,7 +1090,7 @@ InputParameters::addCustomTypeParam(const std::string & name,
                                     const std::string & doc_string)
 {
   addParam<T>(name, doc_string);
-  _custom_type[name] = custom_type;
+  writableMetadata().custom_type[name] = custom_type;
 }
 
 template <typename T>
@@ -1099,7 +1123,7 @@ InputParameters::addRequiredCommandLineParam(const std::string & name,
                                              const std::string & doc_string)
 {
   addRequiredParam<T>(name, doc_string);
-  MooseUtils::tokenize(syntax, _syntax[name], 1, " \t\n\v\f\r");
+  MooseUtils::tokenize(syntax, writableMetadata().syntax[name], 1, " \t\n\v\f\r");
 }
 
 template <typename T>
@@ -1109,7 +1133,7 @@ InputParameters::addCommandLineParam(const std::string & name,
                                      const std::string & doc_string)
 {
   addParam<T>(name, doc_string);
-  MooseUtils::tokenize(syntax, _syntax[name], 1, " \t\n\v\f\r");
+  MooseUtils::tokenize(syntax, writableMetadata().syntax[name], 1, " \t\n\v\f\r");
 }
 
 template <typename T>
@@ -1120,7 +1144,7 @@ InputParameters::addCommandLineParam(const std::string & name,
                                      const std::string & doc_string)
 {
   addParam<T>(name, value, doc_string);
-  MooseUtils::tokenize(syntax, _syntax[name], 1, " \t\n\v\f\r");
+  MooseUtils::tokenize(syntax, writableMetadata().syntax[name], 1, " \t\n\v\f\r");
 }
 
 template <typename T>
@@ -1159,7 +1183,7 @@ InputParameters::addRequiredDeprecatedParam(const std::string & name,
   _show_deprecated_message = false;
   addRequiredParam<T>(name, doc_string);
 
-  _deprecated_params.insert(std::make_pair(name, deprecation_message));
+  writableMetadata().deprecated_params.insert(std::make_pair(name, deprecation_message));
   _show_deprecated_message = true;
 }
 
@@ -1173,7 +1197,7 @@ InputParameters::addDeprecatedParam(const std::string & name,
   _show_deprecated_message = false;
   addParam<T>(name, value, doc_string);
 
-  _deprecated_params.insert(std::make_pair(name, deprecation_message));
+  writableMetadata().deprecated_params.insert(std::make_pair(name, deprecation_message));
   _show_deprecated_message = true;
 }
 
@@ -1186,7 +1210,7 @@ InputParameters::addDeprecatedParam(const std::string & name,
   _show_deprecated_message = false;
   addParam<T>(name, doc_string);
 
-  _deprecated_params.insert(std::make_pair(name, deprecation_message));
+  writableMetadata().deprecated_params.insert(std::make_pair(name, deprecation_message));
   _show_deprecated_message = true;
 }
 
@@ -0,0 +1,110 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// C++ includes
+#include <vector>
+
+/**
+ * A static k-d tree over a set of points, used to answer nearest neighbor
+ * and radius queries in O(log n) instead of scanning every point.  The tree
+ * stores a copy of the points, so it must be rebuilt by the caller whenever
+ * the underlying geometry changes.
+ */
+class KDTree
+{
+public:
+  /**
+   * @param points The points to build the tree over.  Query results index into this vector.
+   * @param max_leaf_size The maximum number of points held in a leaf of the tree.
+   */
+  KDTree(const std::vector<Point> & points, unsigned int max_leaf_size = 10);
+
+  /**
+   * Find the point closest to \p query.
+   * @param query The point to search around.
+   * @param index Will hold the index of the nearest point.
+   * @param distance Will hold the distance between \p query and the nearest point.
+   * @return false if the tree is empty, true otherwise.
+   */
+  bool neighborSearch(const Point & query, std::size_t & index, Real & distance) const;
+
+  /**
+   * Find the \p n points closest to \p query, sorted by increasing distance.
+   * Fewer than \p n points are returned if the tree holds less than \p n points.
+   */
+  void neighborSearch(const Point & query,
+                      unsigned int n,
+                      std::vector<std::size_t> & indices,
+                      std::vector<Real> & distances) const;
+
+  /**
+   * Find all points within \p radius of \p query (in no particular order).
+   */
+  void radiusSearch(const Point & query, Real radius, std::vector<std::size_t> & indices) const;
+
+  /// The number of points in the tree
+  std::size_t size() const { return _points.size(); }
+
+  /// The point stored at \p index
+  const Point & point(std::size_t index) const { return _points[index]; }
+
+private:
+  /// A node of the tree.  Leaves have left == right == invalid_node.
+  struct TreeNode
+  {
+    std::size_t begin;
+    std::size_t end;
+    unsigned int dim;
+    Real split;
+    unsigned int left;
+    unsigned int right;
+  };
+
+  /// Recursively build the subtree holding _index[begin, end), returning its node number
+  unsigned int build(std::size_t begin, std::size_t end);
+
+  /// Keep the \p n closest points seen so far in the max-heap \p best
+  void nearestRecurse(unsigned int node,
+                      const Point & query,
+                      unsigned int n,
+                      std::vector<std::pair<Real, std::size_t>> & best) const;
+
+  void radiusRecurse(unsigned int node,
+                     const Point & query,
+                     Real radius_sq,
+                     std::vector<std::size_t> & indices) const;
+
+  static const unsigned int invalid_node;
+
+  std::vector<Point> _points;
+
+  /// Permutation of point indices; each tree node owns a contiguous range of it
+  std::vector<std::size_t> _index;
+
+  std::vector<TreeNode> _nodes;
+
+  unsigned int _max_leaf_size;
+};
+
+#endif // KDTREE_H
@@ -53,6 +53,19 @@ public:
    */
   Real sample(Real x) const;
 
+  /**
+   * Same as sample(Real), but \p hint is used as the first guess for the interval containing
+   * \p x and is updated with the interval that was found.  Callers sampling monotonically
+   * (e.g. in time) can keep the hint between calls to skip the interval search.
+   */
+  Real sample(Real x, unsigned int & hint) const;
+
+  /**
+   * Sample the fit at each of the abscissas in \p x, storing the results in \p y.
+   * Consecutive values are used as hints for one another, so sorted input is fastest.
+   */
+  void sample(const std::vector<Real> & x, std::vector<Real> & y) const;
+
   /**
    * This function will take an independent variable input and will return the derivative of the
    * dependent variable
@@ -60,6 +73,11 @@ public:
    */
   Real sampleDerivative(Real x) const;
 
+  /**
+   * Same as sampleDerivative(Real), using and updating an interval hint (see sample()).
+   */
+  Real sampleDerivative(Real x, unsigned int & hint) const;
+
   /**
    * This function will dump GNUPLOT input files that can be run to show the data points and
    * function fits
@@ -87,6 +105,13 @@ public:
   Real range(int i) const;
 
 private:
+  /**
+   * Return the index i of the interval such that _x[i] <= x < _x[i+1].  \p x must lie
+   * within [_x[0], _x.back()).  The intervals \p hint and \p hint + 1 are checked
+   * before falling back to a binary search.
+   */
+  unsigned int findInterval(Real x, unsigned int hint) const;
+
   std::vector<Real> _x;
   std::vector<Real> _y;
 
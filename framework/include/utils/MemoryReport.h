@@ -0,0 +1,99 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MEMORYREPORT_H
+#define MEMORYREPORT_H
+
+// C++ includes
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+namespace Parallel
+{
+class Communicator;
+}
+}
+
+/**
+ * Collects the number of bytes held by the large data structures of a simulation (mesh, DOF
+ * maps, vectors and matrices, stateful material properties, geometric search, restartable data
+ * and the assembly caches) so that an out of memory failure can be traced to a subsystem.
+ *
+ * The numbers are estimates computed from the sizes of the containers, not measurements of the
+ * heap; they are meant to be compared to each other and to the total reported by MemoryUsage.
+ * Every processor must add the same subsystems in the same order before calling print().
+ */
+class MemoryReport
+{
+public:
+  /// The bytes of one subsystem on one processor, and its sum and maximum over all processors
+  struct Entry
+  {
+    std::string name;
+    std::size_t local = 0;
+    std::size_t total = 0;
+    std::size_t max = 0;
+  };
+
+  /**
+   * Add \p bytes to the subsystem \p name, creating it if this is the first contribution
+   */
+  void add(const std::string & name, std::size_t bytes);
+
+  /**
+   * The subsystems in the order they were first added
+   */
+  const std::vector<Entry> & entries() const { return _entries; }
+
+  /**
+   * Sum and maximize the entries over all processors (collective)
+   */
+  void aggregate(const libMesh::Parallel::Communicator & comm);
+
+  /**
+   * Aggregate the entries and print them as a table (collective)
+   */
+  void print(std::ostream & os, const libMesh::Parallel::Communicator & comm);
+
+  ///@{
+  /**
+   * Estimates of the memory held by standard containers, including the per entry overhead of
+   * the node based containers
+   */
+  template <typename T>
+  static std::size_t bytes(const std::vector<T> & v)
+  {
+    return v.capacity() * sizeof(T);
+  }
+
+  template <typename Container>
+  static std::size_t nodeBytes(const Container & c)
+  {
+    return c.size() * (sizeof(typename Container::value_type) + node_overhead);
+  }
+  ///@}
+
+protected:
+  /// Bookkeeping of one entry of a std::map, std::set or hash table (pointers and color/hash)
+  static const std::size_t node_overhead = 4 * sizeof(void *);
+
+  std::vector<Entry> _entries;
+};
+
+#endif // MEMORYREPORT_H
@@ -19,6 +19,8 @@
 #include "MooseError.h"
 #include "DataIO.h"
 
+#include <array>
+#include <cmath>
 #include <unordered_map>
 
 // External library includes
@@ -38,6 +40,12 @@
  *    generators can be saved and restored for all streams by using the "saveState" and
  *    "restoreState" methods.  Finally, this class uses a fast hash map so that indexes
  *    for the generators are not required to be contiguous.
+ *
+ * 3. COUNTER-BASED INTERFACE:
+ *    The counterRand* functions implement the Philox4x32-10 generator, which maps a
+ *    (seed, id, step, index) tuple directly to a random number. They hold no state, so any number
+ *    of independent streams (e.g. one per mesh entity and time step) are available in O(1), in
+ *    any order and from any thread.
  */
 class MooseRandom
 {
@@ -124,6 +132,91 @@ public:
     return mts_lrand(&(_states[i].first));
   }
 
+  /// A block of four 32-bit numbers of the counter-based generator
+  typedef std::array<uint32_t, 4> CounterBlock;
+
+  /**
+   * The Philox4x32-10 bijection of a 128-bit counter with a 64-bit key
+   * @param counter  the counter
+   * @param key      the key
+   * @return         four random 32-bit numbers
+   */
+  static inline CounterBlock philox(CounterBlock counter, std::array<uint32_t, 2> key)
+  {
+    for (unsigned int round = 0; round < 10; ++round)
+    {
+      if (round > 0)
+      {
+        key[0] += 0x9E3779B9;
+        key[1] += 0xBB67AE85;
+      }
+
+      const uint64_t product0 = uint64_t(0xD2511F53) * counter[0];
+      const uint64_t product1 = uint64_t(0xCD9E8D57) * counter[2];
+      counter = {{uint32_t(product1 >> 32) ^ counter[1] ^ key[0],
+                  uint32_t(product1),
+                  uint32_t(product0 >> 32) ^ counter[3] ^ key[1],
+                  uint32_t(product0)}};
+    }
+    return counter;
+  }
+
+  /**
+   * The block of the counter-based stream identified by seed, id and step
+   * @param seed   the seed number
+   * @param id     the stream id (e.g. a node or element id)
+   * @param step   the stream step (e.g. the time step)
+   * @param block  the index of the block within the stream
+   */
+  static inline CounterBlock counterBlock(uint32_t seed, uint64_t id, uint32_t step, uint32_t block)
+  {
+    return philox({{block, step, uint32_t(id), uint32_t(id >> 32)}}, {{seed, 0}});
+  }
+
+  /**
+   * This method returns the n-th random number (long format) of a counter-based stream
+   * @return      the random number in the range [0,max(uinit32_t)] with 32-bit number
+   */
+  static inline uint32_t counterRandl(uint32_t seed, uint64_t id, uint32_t step, uint32_t n)
+  {
+    return counterBlock(seed, id, step, n / 4)[n % 4];
+  }
+
+  /**
+   * This method returns the n-th random number (double format) of a counter-based stream
+   * @return      the random number in the range [0,1) with 53-bit precision
+   */
+  static inline double counterRand(uint32_t seed, uint64_t id, uint32_t step, uint32_t n)
+  {
+    const CounterBlock b = counterBlock(seed, id, step, n / 2);
+    return toDouble(b[2 * (n % 2)], b[2 * (n % 2) + 1]);
+  }
+
+  /**
+   * This method fills values with the first n random numbers (double format) of a
+   * counter-based stream. The blocks are independent, so the loop vectorizes.
+   */
+  static inline void
+  counterRand(uint32_t seed, uint64_t id, uint32_t step, double * values, unsigned int n)
+  {
+    for (unsigned int i = 0; i < n; ++i)
+      values[i] = counterRand(seed, id, step, i);
+  }
+
+  /**
+   * This method returns the n-th random number (double format) of a counter-based stream
+   * drawn from a normal distribution centered around mean, with a width of sigma
+   * (Box-Muller transform of one block)
+   */
+  static inline double counterRandNormal(
+      uint32_t seed, uint64_t id, uint32_t step, uint32_t n, double mean, double sigma)
+  {
+    const CounterBlock b = counterBlock(seed, id, step, n);
+    const double u1 = 1.0 - toDouble(b[0], b[1]);
+    const double u2 = toDouble(b[2], b[3]);
+    return mean + sigma * std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * libMesh::pi * u2);
+  }
+
   /**
    * This method saves the current state of all generators which can be restored at a later time
    * (i.e. re-generate the same sequence of random numbers of this generator
@@ -157,6 +250,12 @@ public:
   inline unsigned int size() { return _states.size(); }
 
 private:
+  /// Combines two 32-bit numbers into a double in the range [0,1) with 53-bit precision
+  static inline double toDouble(uint32_t a, uint32_t b)
+  {
+    return ((a >> 5) * 67108864.0 + (b >> 6)) * (1.0 / 9007199254740992.0);
+  }
+
   /**
    * We store a pair of states in this map. The first one is the active state, the
    * second is the backup state. It is used to restore state at a later time
@@ -35,6 +35,7 @@ namespace Parallel
 class Communicator;
 }
 }
+class MaterialPropertyStorage;
 
 namespace MooseUtils
 {
@@ -269,15 +270,14 @@ bool relativeFuzzyLessThan(const libMesh::Real & var1,
 
 /**
  * Function to dump the contents of MaterialPropertyStorage for debugging purposes
- * @param props The storage item to dump, this should be
- * MaterialPropertyStorage.props()/propsOld()/propsOlder().
+ * @param storage The storage to dump
+ * @param state The state to dump: 0 for current, 1 for old and 2 for older properties
  *
  * Currently this only words for scalar material properties. Something to do as needed would be to
  * create a method in MaterialProperty
  * that may be overloaded to dump the type using template specialization.
  */
-void MaterialPropertyStorageDump(
-    const HashMap<const libMesh::Elem *, HashMap<unsigned int, MaterialProperties>> & props);
+void MaterialPropertyStorageDump(const MaterialPropertyStorage & storage, unsigned int state = 0);
 
 /**
  * Indents the supplied message given the prefix and color
@@ -0,0 +1,202 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTTIMING_H
+#define OBJECTTIMING_H
+
+#include "MooseTypes.h"
+
+// C++ includes
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+class MooseObject;
+
+namespace libMesh
+{
+namespace Parallel
+{
+class Communicator;
+}
+}
+
+/**
+ * Accumulated time per MooseObject in the hot methods of kernels, materials and user objects.
+ *
+ * Unlike the sections of the PerfGraph the objects are not registered up front: the first call
+ * of an object on a thread adds it to the table of that thread, later calls only cost a hash
+ * lookup and two reads of the cycle counter.  The tables are never shared between threads, so
+ * no locking is needed while timing.  The cycles are converted to seconds with the rate measured
+ * between enable() and the time of the report.  While disabled an ObjectTimer only tests a flag.
+ */
+class ObjectTiming
+{
+public:
+  /// The timed methods
+  enum Method
+  {
+    COMPUTE_RESIDUAL = 0,
+    COMPUTE_JACOBIAN,
+    COMPUTE_QP_PROPERTIES,
+    EXECUTE,
+    NUM_METHODS
+  };
+
+  /// The values accumulated for one method of one object
+  struct Counter
+  {
+    unsigned long int calls = 0;
+    unsigned long long int cycles = 0;
+  };
+
+  /// The time of one method of one object, summed over all threads and processors
+  struct Record
+  {
+    std::string name;
+    std::string type;
+    Method method;
+    unsigned long int calls;
+
+    /// Time summed over all threads and processors (seconds)
+    double total;
+
+    /// Largest time of a single processor (seconds)
+    double max_process;
+  };
+
+  ObjectTiming();
+
+  /**
+   * Enable the timing, must be called outside of the threaded loops as it sizes the per thread
+   * tables.  Enabling the timing again keeps the accumulated values.
+   */
+  void enable();
+  bool enabled() const { return _enabled; }
+
+  /// Reset the accumulated values
+  void clear();
+
+  /// The counter of a method of an object on the given thread
+  Counter & counter(const MooseObject & object, Method method, THREAD_ID tid)
+  {
+    auto & objects = _thread_objects[tid];
+    auto it = objects.find(&object);
+    if (it == objects.end())
+      it = addObject(object, tid);
+    return it->second.counters[method];
+  }
+
+  /// Read the cycle counter (the steady clock on platforms without one)
+  static unsigned long long int cycles()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+  }
+
+  /// The seconds per cycle measured since the timing was enabled
+  double secondsPerCycle() const;
+
+  /**
+   * The values of this processor for the objects with this name summed over the threads and the
+   * given method, or over all methods for NUM_METHODS.
+   */
+  Counter localData(const std::string & name, Method method) const;
+
+  /**
+   * The records of all objects timed on any processor, sorted by decreasing total time.
+   * This method is collective on the communicator.
+   */
+  std::vector<Record> records(const Parallel::Communicator & comm) const;
+
+  /// Print the records as a table, collective on the communicator
+  void print(std::ostream & os, const Parallel::Communicator & comm) const;
+
+  /// The name of a timed method
+  static const std::string & methodName(Method method);
+
+private:
+  struct ObjectData
+  {
+    std::string name;
+    std::string type;
+    std::array<Counter, NUM_METHODS> counters;
+  };
+
+  typedef std::unordered_map<const MooseObject *, ObjectData> ObjectMap;
+
+  /// Add an object to the table of a thread
+  ObjectMap::iterator addObject(const MooseObject & object, THREAD_ID tid);
+
+  bool _enabled;
+
+  /// The timed objects of each thread
+  std::vector<ObjectMap> _thread_objects;
+
+  ///@{
+  /// The cycle counter and clock when the timing was enabled, used to calibrate the counter
+  unsigned long long int _start_cycles;
+  std::chrono::steady_clock::time_point _start_time;
+  ///@}
+};
+
+/**
+ * Adds the time spent during the lifetime of the guard to an object:
+ *
+ *   ObjectTimer timer(Moose::object_timing, *kernel, ObjectTiming::COMPUTE_RESIDUAL, _tid);
+ *   kernel->computeResidual();
+ */
+class ObjectTimer
+{
+public:
+  ObjectTimer(ObjectTiming & timing,
+              const MooseObject & object,
+              ObjectTiming::Method method,
+              THREAD_ID tid)
+    : _counter(timing.enabled() ? &timing.counter(object, method, tid) : nullptr),
+      _start(_counter ? ObjectTiming::cycles() : 0)
+  {
+  }
+
+  ~ObjectTimer()
+  {
+    if (_counter)
+    {
+      _counter->cycles += ObjectTiming::cycles() - _start;
+      _counter->calls++;
+    }
+  }
+
+  ObjectTimer(const ObjectTimer &) = delete;
+  ObjectTimer & operator=(const ObjectTimer &) = delete;
+
+private:
+  /// The counter the time is added to, nullptr when the timing is disabled
+  ObjectTiming::Counter * const _counter;
+
+  /// The cycle counter when the guard was created
+  const unsigned long long int _start;
+};
+
+#endif // OBJECTTIMING_H
@@ -0,0 +1,248 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef PERFGRAPH_H
+#define PERFGRAPH_H
+
+// C++ includes
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * A tree of nested, timed code sections.
+ *
+ * Sections are registered once (usually through a function-local static) and are then
+ * referred to by their integer ID, so timing a section costs a clock read and a short search
+ * through the children of the current section instead of the string lookups done by a
+ * PerfLog.  Each thread accumulates into its own tree, the trees are merged when the graph is
+ * reported.  While the graph is disabled a PerfGuard does nothing but test a flag.
+ */
+class PerfGraph
+{
+public:
+  typedef unsigned int PerfID;
+
+  /// The accumulated values of a section
+  struct SectionData
+  {
+    unsigned long int calls = 0;
+
+    /// Time spent in the section itself, excluding the nested sections (seconds)
+    double self = 0;
+
+    /// Time spent in the section including the nested sections (seconds)
+    double total = 0;
+  };
+
+  PerfGraph();
+
+  /**
+   * Register a section, registering the same name and category again returns the same ID.
+   * This method is thread safe.
+   */
+  PerfID registerSection(const std::string & name, const std::string & category);
+
+  /// The name of a registered section
+  const std::string & sectionName(PerfID id) const;
+
+  /// The category of a registered section
+  const std::string & sectionCategory(PerfID id) const;
+
+  /// Whether a section with this name and category was registered
+  bool hasSection(const std::string & name, const std::string & category) const;
+
+  ///@{
+  /// Enable/disable the timing.  Sections entered while disabled are not recorded.
+  void enable() { _enabled = true; }
+  void disable() { _enabled = false; }
+  bool enabled() const { return _enabled; }
+  ///@}
+
+  /// Start timing a section nested in the current section of this thread
+  void push(PerfID id);
+
+  /// Stop timing the current section of this thread
+  void pop();
+
+  /**
+   * The values of a section summed over all the places in the graph (and all threads) it was
+   * entered from.  Time spent in sections that are still running is included.
+   */
+  SectionData sectionData(const std::string & name, const std::string & category) const;
+
+  /// Print the merged graph as an indented table
+  void print(std::ostream & os) const;
+
+  /// Write the merged graph as JSON
+  void printJSON(std::ostream & os) const;
+
+  /**
+   * Start recording a timeline of the sections (in addition to the graph), which also enables
+   * the graph.  The times of the timeline are measured from the first call.
+   */
+  void enableTrace();
+  bool tracing() const { return _tracing; }
+
+  /// Seconds since the trace was enabled
+  double traceTime() const;
+
+  ///@{
+  /**
+   * Add an event that is not a section to the timeline of the calling thread: a span from
+   * \p start to \p end (see traceTime()) with an optional integer argument (e.g. an iteration
+   * number), or the current value of a counter (e.g. a residual norm).
+   */
+  void traceSpan(PerfID id, double start, double end, int arg = -1);
+  void traceCounter(PerfID id, double value);
+  ///@}
+
+  /**
+   * Write the timeline of every thread as events of the Chrome trace event format (entries of
+   * the "traceEvents" array), each preceded by a comma, with the given process id.
+   * @return whether any event was written
+   */
+  bool printTrace(std::ostream & os, unsigned int pid) const;
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  struct Node
+  {
+    Node(PerfID id, Node * parent) : _id(id), _parent(parent) {}
+
+    /// The child for the given section, created when it does not exist yet
+    Node * child(PerfID id);
+
+    /// The accumulated time, including the current call when the section is running
+    double totalTime(const Clock::time_point & now) const;
+
+    const PerfID _id;
+    Node * const _parent;
+    unsigned long int _calls = 0;
+    double _total = 0;
+    bool _running = false;
+    Clock::time_point _start;
+    std::vector<std::unique_ptr<Node>> _children;
+  };
+
+  /// An entry of the timeline (times in seconds since the trace was enabled)
+  struct TraceEvent
+  {
+    PerfID id;
+    double start;
+
+    /// The end of a span, the value for a counter
+    double value;
+
+    /// The argument of a span, -1 for none
+    int arg;
+
+    bool counter;
+  };
+
+  /// The tree of a single thread
+  struct ThreadGraph
+  {
+    ThreadGraph() : _root(INVALID_ID, nullptr), _current(&_root) {}
+
+    Node _root;
+    Node * _current;
+    std::vector<TraceEvent> _trace;
+  };
+
+  /// The graph of the calling thread
+  ThreadGraph & threadGraph();
+
+  /// Merge the thread graphs into a single tree
+  void merge(Node & merged) const;
+  void mergeNode(const Node & from, Node & to, const Clock::time_point & now) const;
+
+  ///@{
+  /// Helpers for walking the merged tree
+  void sumSection(const Node & node, PerfID id, bool inside, SectionData & data) const;
+  void printNode(std::ostream & os, const Node & node, unsigned int depth, double graph_total) const;
+  void printNodeJSON(std::ostream & os, const Node & node, unsigned int depth) const;
+  ///@}
+
+  static const PerfID INVALID_ID;
+
+  /// Unique number of this graph, used to find the thread graphs of the calling thread
+  const unsigned int _serial;
+
+  bool _enabled;
+
+  /// Whether the timeline is recorded
+  bool _tracing;
+
+  /// The time the trace was enabled
+  Clock::time_point _trace_start;
+
+  ///@{
+  /// The registered sections
+  std::vector<std::string> _names;
+  std::vector<std::string> _categories;
+  std::map<std::pair<std::string, std::string>, PerfID> _ids;
+  ///@}
+
+  /// The graph of each thread that timed a section
+  std::map<std::thread::id, std::unique_ptr<ThreadGraph>> _thread_graphs;
+
+  mutable std::mutex _mutex;
+};
+
+/**
+ * Times a section of code for the lifetime of the guard:
+ *
+ *   static const PerfGraph::PerfID timer = Moose::perf_graph.registerSection("solve()", "Execution");
+ *   PerfGuard guard(Moose::perf_graph, timer);
+ */
+class PerfGuard
+{
+public:
+  PerfGuard(PerfGraph & graph, PerfGraph::PerfID id) : _graph(graph.enabled() ? &graph : nullptr)
+  {
+    if (_graph)
+      _graph->push(id);
+  }
+
+  /// For sections with names built at runtime, registering them costs a lookup per call
+  PerfGuard(PerfGraph & graph, const std::string & name, const std::string & category)
+    : _graph(graph.enabled() ? &graph : nullptr)
+  {
+    if (_graph)
+      _graph->push(_graph->registerSection(name, category));
+  }
+
+  ~PerfGuard()
+  {
+    if (_graph)
+      _graph->pop();
+  }
+
+  PerfGuard(const PerfGuard &) = delete;
+  PerfGuard & operator=(const PerfGuard &) = delete;
+
+private:
+  /// The graph the section was pushed to, nullptr when the graph was disabled
+  PerfGraph * const _graph;
+};
+
+#endif // PERFGRAPH_H
@@ -62,6 +62,12 @@ public:
  */
 void petscSetOptions(FEProblemBase & problem);
 
+/**
+ * Add the BoomerAMG options of low operator complexity requested by "low_memory_amg" to the
+ * options not already set in \p petsc (only when hypre BoomerAMG is the preconditioner)
+ */
+void setLowMemoryAMGOptions(const PetscOptions & petsc);
+
 /**
  * Sets the default options for PETSc
  */
@@ -71,6 +77,18 @@ void petscSetupDM(NonlinearSystemBase & nl);
 
 PetscErrorCode petscSetupOutput(CommandLine * cmd_line);
 
+/**
+ * Replace the function differenced by the PETSc matrix-free Jacobian (if there is one) with
+ * petscJacobianActionResidual()
+ */
+void petscSetupJacobianAction(FEProblemBase & problem);
+
+/**
+ * The function differenced by the matrix-free Jacobian when kernel_jacobian_action is set: only
+ * the nonlinear residual objects are evaluated at the perturbed solution
+ */
+PetscErrorCode petscJacobianActionResidual(void * ctx, Vec x, Vec r);
+
 /**
  * Helper function for outputing the norm values with/without color
  */
@@ -48,6 +48,11 @@ public:
    */
   unsigned int getSeed(dof_id_type id);
 
+  /**
+   * Number of times the counter-based streams have been reset
+   */
+  unsigned int getResetCount() const { return _reset_count; }
+
 private:
   void updateGenerators();
 
@@ -59,6 +64,8 @@ private:
 
   MooseRandom _generator;
   bool _is_nodal;
+  bool _counter_based;
+  unsigned int _reset_count;
   ExecFlagType _reset_on;
 
   unsigned int _master_seed;
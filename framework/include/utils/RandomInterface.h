@@ -17,6 +17,8 @@
 
 #include "MooseTypes.h"
 
+#include <unordered_map>
+
 // Forward declarations
 class Assembly;
 class FEProblemBase;
@@ -73,11 +75,15 @@ public:
    **************************************************/
   unsigned int getMasterSeed() const { return _master_seed; }
   bool isNodal() const { return _is_nodal; }
+  bool isCounterBased() const { return _counter_based; }
   ExecFlagType getResetOnTime() const { return _reset_on; }
 
   void setRandomDataPointer(RandomData * random_data);
 
 private:
+  /// Returns the index of the next number in the counter-based stream of the given id
+  unsigned int nextCounter(dof_id_type id) const;
+
   RandomData * _random_data;
   mutable MooseRandom * _generator;
 
@@ -85,12 +91,19 @@ private:
   const std::string _ri_name;
 
   unsigned int _master_seed;
+  const bool _counter_based;
   bool _is_nodal;
   ExecFlagType _reset_on;
 
   const Node *& _curr_node;
   const Elem *& _curr_element;
 
+  ///@{ Number of values drawn from each counter-based stream since the last reset
+  mutable std::unordered_map<dof_id_type, unsigned int> _counters;
+  mutable unsigned int _counter_step;
+  mutable unsigned int _counter_reset;
+  ///@}
+
   //  friend void FEProblemBase::registerRandomInterface(RandomInterface *random_interface, const
   //  std::string & name, ExecFlagType exec_flag);
 };
@@ -192,6 +192,13 @@ void dataStore(std::ostream &, RankThreeTensor &, void *);
 template <>
 void dataLoad(std::istream &, RankThreeTensor &, void *);
 
+/// The tensor is stored as its raw component array, allowing bulk writes of contiguous containers
+template <>
+struct DataIOBulkCopyable<RankThreeTensor>
+{
+  static constexpr bool value = sizeof(RankThreeTensor) == LIBMESH_DIM * LIBMESH_DIM * LIBMESH_DIM * sizeof(Real);
+};
+
 inline RankThreeTensor operator*(Real a, const RankThreeTensor & b) { return b * a; }
 
 ///r=v*A where r is rank 2, v is vector and A is rank 3
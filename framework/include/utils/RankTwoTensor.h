@@ -446,4 +446,11 @@ void dataStore(std::ostream & stream, RankTwoTensor &, void *);
 template <>
 void dataLoad(std::istream & stream, RankTwoTensor &, void *);
 
+/// The tensor is stored as its raw component array, allowing bulk writes of contiguous containers
+template <>
+struct DataIOBulkCopyable<RankTwoTensor>
+{
+  static constexpr bool value = sizeof(RankTwoTensor) == LIBMESH_DIM * LIBMESH_DIM * sizeof(Real);
+};
+
 #endif // RANKTWOTENSOR_H
@@ -48,6 +48,29 @@ void elementsIntersectedByLine(const Point & p0,
                                const PointLocatorBase & point_locator,
                                std::vector<Elem *> & intersected_elems,
                                std::vector<LineSegment> & segments);
+
+/**
+ * Find all of the elements intersected by each line of a batch of lines.
+ *
+ * The lines are traced concurrently on the available threads.  On a
+ * replicated mesh every processor traces every line completely, just
+ * like elementsIntersectedByLine().  On a distributed mesh each
+ * processor only walks across the elements it owns and hands a line
+ * over to the neighboring processor where it leaves the local
+ * partition, so the mesh never has to be gathered: each processor
+ * ends up with the (ordered) pieces of every line crossing its
+ * local elements.
+ *
+ * This must be called on all processors with the same lines.
+ *
+ * @param lines The lines to trace
+ * @param intersected_elems The elements intersected by each line
+ * @param segments The line segments across each element, for each line
+ */
+void elementsIntersectedByLines(const std::vector<LineSegment> & lines,
+                                const MooseMesh & mesh,
+                                std::vector<std::vector<Elem *>> & intersected_elems,
+                                std::vector<std::vector<LineSegment>> & segments);
 }
 
 #endif // RAYTRACING_H
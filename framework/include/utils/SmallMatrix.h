@@ -0,0 +1,289 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SMALLMATRIX_H
+#define SMALLMATRIX_H
+
+// MOOSE includes
+#include "Moose.h"      // using namespace libMesh
+#include "MooseError.h" // mooseException
+
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/**
+ * A square N x N matrix with its values stored column major on the stack, for the small dense
+ * matrices (3x3, 6x6 and 9x9) the mechanics models work with at every quadrature point.
+ *
+ * The static kernels work on raw column major data, so that ColumnMajorMatrix can route
+ * matrices of these sizes to them without copying. None of them calls LAPACK.
+ */
+template <unsigned int N>
+class SmallMatrix
+{
+public:
+  /// A zero matrix
+  SmallMatrix() { zero(); }
+
+  Real & operator()(unsigned int i, unsigned int j) { return _values[j * N + i]; }
+  Real operator()(unsigned int i, unsigned int j) const { return _values[j * N + i]; }
+
+  Real * rawData() { return _values.data(); }
+  const Real * rawData() const { return _values.data(); }
+
+  void zero() { _values.fill(0.0); }
+  void identity();
+
+  SmallMatrix operator*(const SmallMatrix & rhs) const;
+
+  /// The inverse; throws a MooseException if the matrix is singular
+  SmallMatrix inverse() const;
+
+  /**
+   * Eigenvalues in ascending order and the corresponding eigenvectors (as columns) of the
+   * matrix, which must be symmetric
+   */
+  void symmetricEigen(std::array<Real, N> & eval, SmallMatrix & evec) const;
+
+  ///@{
+  /**
+   * Kernels on column major N x N data. The output must not be one of the inputs.
+   */
+
+  /// c = a * b, summing over k in ascending order like the naive triple loop does
+  static void multiply(const Real * a, const Real * b, Real * c);
+
+  /// Returns false, leaving inv undefined, if a is singular
+  static bool invert(const Real * a, Real * inv);
+
+  /// Cyclic Jacobi rotations, see symmetricEigen()
+  static void symmetricEigen(const Real * a, Real * eval, Real * evec);
+  ///@}
+
+private:
+  std::array<Real, N * N> _values;
+};
+
+template <unsigned int N>
+void
+SmallMatrix<N>::identity()
+{
+  zero();
+  for (unsigned int i = 0; i < N; ++i)
+    (*this)(i, i) = 1.0;
+}
+
+template <unsigned int N>
+SmallMatrix<N> SmallMatrix<N>::operator*(const SmallMatrix & rhs) const
+{
+  SmallMatrix<N> ret;
+  multiply(rawData(), rhs.rawData(), ret.rawData());
+  return ret;
+}
+
+template <unsigned int N>
+SmallMatrix<N>
+SmallMatrix<N>::inverse() const
+{
+  SmallMatrix<N> ret;
+  if (!invert(rawData(), ret.rawData()))
+    mooseException("Singular matrix in SmallMatrix::inverse()");
+  return ret;
+}
+
+template <unsigned int N>
+void
+SmallMatrix<N>::symmetricEigen(std::array<Real, N> & eval, SmallMatrix & evec) const
+{
+  symmetricEigen(rawData(), eval.data(), evec.rawData());
+}
+
+template <unsigned int N>
+void
+SmallMatrix<N>::multiply(const Real * a, const Real * b, Real * c)
+{
+  for (unsigned int i = 0; i < N * N; ++i)
+    c[i] = 0.0;
+
+  // Column j of c accumulates the columns of a; the innermost loop runs over contiguous data and
+  // has a compile time length, so that it is vectorized
+  for (unsigned int j = 0; j < N; ++j)
+    for (unsigned int k = 0; k < N; ++k)
+    {
+      const Real b_kj = b[j * N + k];
+      const Real * a_k = a + k * N;
+      Real * c_j = c + j * N;
+      for (unsigned int i = 0; i < N; ++i)
+        c_j[i] += a_k[i] * b_kj;
+    }
+}
+
+template <unsigned int N>
+bool
+SmallMatrix<N>::invert(const Real * a, Real * inv)
+{
+  if (N == 3)
+  {
+    // Closed form: the transposed cofactors over the determinant
+    inv[0] = a[4] * a[8] - a[7] * a[5];
+    inv[1] = a[7] * a[2] - a[1] * a[8];
+    inv[2] = a[1] * a[5] - a[4] * a[2];
+    inv[3] = a[6] * a[5] - a[3] * a[8];
+    inv[4] = a[0] * a[8] - a[6] * a[2];
+    inv[5] = a[3] * a[2] - a[0] * a[5];
+    inv[6] = a[3] * a[7] - a[6] * a[4];
+    inv[7] = a[6] * a[1] - a[0] * a[7];
+    inv[8] = a[0] * a[4] - a[3] * a[1];
+
+    const Real det = a[0] * inv[0] + a[3] * inv[1] + a[6] * inv[2];
+    if (det == 0.0)
+      return false;
+
+    for (unsigned int i = 0; i < 9; ++i)
+      inv[i] /= det;
+    return true;
+  }
+
+  // Gauss-Jordan elimination with partial pivoting on a copy of a, applied to the identity
+  std::array<Real, N * N> lu;
+  for (unsigned int i = 0; i < N * N; ++i)
+  {
+    lu[i] = a[i];
+    inv[i] = 0.0;
+  }
+  for (unsigned int i = 0; i < N; ++i)
+    inv[i * N + i] = 1.0;
+
+  for (unsigned int col = 0; col < N; ++col)
+  {
+    unsigned int pivot = col;
+    for (unsigned int row = col + 1; row < N; ++row)
+      if (std::abs(lu[col * N + row]) > std::abs(lu[col * N + pivot]))
+        pivot = row;
+
+    if (lu[col * N + pivot] == 0.0)
+      return false;
+
+    if (pivot != col)
+      for (unsigned int j = 0; j < N; ++j)
+      {
+        std::swap(lu[j * N + col], lu[j * N + pivot]);
+        std::swap(inv[j * N + col], inv[j * N + pivot]);
+      }
+
+    const Real scale = 1.0 / lu[col * N + col];
+    for (unsigned int j = 0; j < N; ++j)
+    {
+      lu[j * N + col] *= scale;
+      inv[j * N + col] *= scale;
+    }
+
+    for (unsigned int row = 0; row < N; ++row)
+    {
+      const Real factor = lu[col * N + row];
+      if (row == col || factor == 0.0)
+        continue;
+
+      for (unsigned int j = 0; j < N; ++j)
+      {
+        lu[j * N + row] -= factor * lu[j * N + col];
+        inv[j * N + row] -= factor * inv[j * N + col];
+      }
+    }
+  }
+
+  return true;
+}
+
+template <unsigned int N>
+void
+SmallMatrix<N>::symmetricEigen(const Real * a, Real * eval, Real * evec)
+{
+  std::array<Real, N * N> d;
+  for (unsigned int i = 0; i < N * N; ++i)
+  {
+    d[i] = a[i];
+    evec[i] = 0.0;
+  }
+  for (unsigned int i = 0; i < N; ++i)
+    evec[i * N + i] = 1.0;
+
+  Real norm = 0.0;
+  for (unsigned int i = 0; i < N * N; ++i)
+    norm += d[i] * d[i];
+
+  for (unsigned int sweep = 0; sweep < 50; ++sweep)
+  {
+    Real off = 0.0;
+    for (unsigned int q = 0; q < N; ++q)
+      for (unsigned int p = 0; p < q; ++p)
+        off += d[q * N + p] * d[q * N + p];
+
+    if (off <= norm * 1e-30)
+      break;
+
+    for (unsigned int q = 1; q < N; ++q)
+      for (unsigned int p = 0; p < q; ++p)
+      {
+        const Real d_pq = d[q * N + p];
+        if (d_pq == 0.0)
+          continue;
+
+        // The rotation zeroing d(p, q), with the smaller of the two possible angles
+        const Real theta = (d[q * N + q] - d[p * N + p]) / (2.0 * d_pq);
+        const Real t = (theta >= 0.0 ? 1.0 : -1.0) /
+                       (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+        const Real c = 1.0 / std::sqrt(t * t + 1.0);
+        const Real s = t * c;
+
+        for (unsigned int k = 0; k < N; ++k)
+        {
+          const Real d_kp = d[p * N + k];
+          const Real d_kq = d[q * N + k];
+          d[p * N + k] = c * d_kp - s * d_kq;
+          d[q * N + k] = s * d_kp + c * d_kq;
+        }
+        for (unsigned int k = 0; k < N; ++k)
+        {
+          const Real d_pk = d[k * N + p];
+          const Real d_qk = d[k * N + q];
+          d[k * N + p] = c * d_pk - s * d_qk;
+          d[k * N + q] = s * d_pk + c * d_qk;
+        }
+        for (unsigned int k = 0; k < N; ++k)
+        {
+          const Real v_kp = evec[p * N + k];
+          const Real v_kq = evec[q * N + k];
+          evec[p * N + k] = c * v_kp - s * v_kq;
+          evec[q * N + k] = s * v_kp + c * v_kq;
+        }
+      }
+  }
+
+  for (unsigned int i = 0; i < N; ++i)
+    eval[i] = d[i * N + i];
+
+  // Sort in ascending order, moving the eigenvector columns along
+  for (unsigned int i = 1; i < N; ++i)
+    for (unsigned int j = i; j > 0 && eval[j] < eval[j - 1]; --j)
+    {
+      std::swap(eval[j], eval[j - 1]);
+      for (unsigned int k = 0; k < N; ++k)
+        std::swap(evec[j * N + k], evec[(j - 1) * N + k]);
+    }
+}
+
+#endif // SMALLMATRIX_H
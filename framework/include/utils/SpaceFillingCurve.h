@@ -0,0 +1,41 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SPACEFILLINGCURVE_H
+#define SPACEFILLINGCURVE_H
+
+#include <cstdint>
+
+/**
+ * Keys along the Hilbert and Morton (Z-order) space-filling curves for
+ * points on a 2^bits x 2^bits (x 2^bits) integer grid.  Sorting objects by
+ * these keys visits them in an order where objects close in the sequence
+ * are close in space.  dim * bits must not exceed 64.
+ */
+namespace SpaceFillingCurve
+{
+/**
+ * Position of the grid point coords[0..dim-1] along the Hilbert curve
+ * (Skilling's transpose algorithm).
+ */
+uint64_t hilbertKey(const uint32_t * coords, unsigned int dim, unsigned int bits);
+
+/**
+ * Position of the grid point coords[0..dim-1] along the Morton curve,
+ * i.e. the interleaved bits of the coordinates.
+ */
+uint64_t mortonKey(const uint32_t * coords, unsigned int dim, unsigned int bits);
+}
+
+#endif // SPACEFILLINGCURVE_H
@@ -45,6 +45,9 @@ private:
   /// Element ids to record material properties for.
   std::set<unsigned int> _elem_filter;
 
+  /// Whether each processor keeps its own data instead of gathering it on processor zero
+  const bool _distributed;
+
   /// Column of element id info.
   VectorPostprocessorValue & _elem_ids;
 
@@ -0,0 +1,71 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PROCESSORLOADDATA_H
+#define PROCESSORLOADDATA_H
+
+#include "GeneralVectorPostprocessor.h"
+
+// Forward Declarations
+class ProcessorLoadData;
+
+template <>
+InputParameters validParams<ProcessorLoadData>();
+
+/**
+ * Reports the work and the size of the partition of every processor, one entry per processor
+ * in each vector, to diagnose load imbalance.
+ */
+class ProcessorLoadData : public GeneralVectorPostprocessor
+{
+public:
+  ProcessorLoadData(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  /// Total time of the sections of the performance graph with this name (all threads)
+  Real sectionTime(const std::string & name) const;
+
+  VectorPostprocessorValue & _processor_id;
+
+  ///@{
+  /// Accumulated times of this processor (seconds), including the nested sections
+  VectorPostprocessorValue & _residual_time;
+  VectorPostprocessorValue & _jacobian_time;
+  VectorPostprocessorValue & _user_object_time;
+  VectorPostprocessorValue & _output_time;
+  ///@}
+
+  ///@{
+  /// Size of the partition of this processor
+  VectorPostprocessorValue & _elements;
+  VectorPostprocessorValue & _dofs;
+  VectorPostprocessorValue & _ghost_elements;
+  VectorPostprocessorValue & _ghost_dofs;
+  ///@}
+
+  /// Accumulated time this processor waited for the others in the barrier of execute()
+  VectorPostprocessorValue & _idle_time;
+
+  /// All of the above vectors
+  const std::vector<VectorPostprocessorValue *> _vectors;
+
+  /// Local part of _idle_time
+  Real _local_idle_time;
+};
+
+#endif // PROCESSORLOADDATA_H
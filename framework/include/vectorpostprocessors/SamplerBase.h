@@ -113,6 +113,9 @@ protected:
   /// What to sort by
   const unsigned int _sort_by;
 
+  /// Whether each processor only keeps its own samples
+  const bool _distributed;
+
   /// x coordinate of the points
   VectorPostprocessorValue & _x;
   /// y coordinate of the points
@@ -61,6 +61,12 @@ protected:
    */
   VectorPostprocessorValue & declareVector(const std::string & vector_name);
 
+  /**
+   * Declare that every processor only keeps the part of the vectors it computed, the vectors are
+   * not gathered. Outputs write the slice of each processor separately.
+   */
+  void setDistributed();
+
   /// The name of the VectorPostprocessor
   std::string _vpp_name;
 
@@ -88,6 +88,19 @@ public:
    */
   void copyValuesBack();
 
+  /**
+   * Mark the vectors of a VectorPostprocessor as distributed: every processor only holds the
+   * slice of the vectors it computed instead of the complete vectors.
+   * @param vpp_name The name of the VectorPostprocessor
+   */
+  void setDistributed(const std::string & vpp_name);
+
+  /**
+   * Whether the vectors of a VectorPostprocessor are distributed (see setDistributed())
+   * @param vpp_name The name of the VectorPostprocessor
+   */
+  bool isDistributed(const std::string & vpp_name) const;
+
 private:
   VectorPostprocessorValue & getVectorPostprocessorHelper(const VectorPostprocessorName & vpp_name,
                                                           const std::string & vector_name,
@@ -98,6 +111,9 @@ private:
 
   std::set<std::string> _requested_items;
   std::set<std::string> _supplied_items;
+
+  /// The VectorPostprocessors whose vectors are distributed
+  std::set<std::string> _distributed;
 };
 
 #endif // VECTORPOSTPROCESSORDATA_H
@@ -20,6 +20,14 @@ public:
   AddCoupledEqSpeciesKernelsAction(const InputParameters & params);
 
   virtual void act();
+
+protected:
+  /// Adds the AqueousEquilibriumSpeciation material and CondensedEquilibriumSub kernels
+  void addCondensedObjects(const std::vector<NonlinearVariableName> & vars,
+                           const std::vector<Real> & eq_const,
+                           const std::vector<std::vector<Real>> & sto_u,
+                           const std::vector<std::vector<bool>> & primary_participation,
+                           const std::vector<std::vector<std::string>> & primary_species_involved);
 };
 
 #endif // ADDCOUPLEDEQSPECIESKERNELSACTION_H
@@ -0,0 +1,73 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef CONDENSEDEQUILIBRIUMSUB_H
+#define CONDENSEDEQUILIBRIUMSUB_H
+
+#include "Kernel.h"
+
+// Forward Declarations
+class CondensedEquilibriumSub;
+
+template <>
+InputParameters validParams<CondensedEquilibriumSub>();
+
+/**
+ * Condensed contribution of all aqueous equilibrium species to the mass balance of one
+ * primary species, replacing the per-reaction CoupledBEEquilibriumSub,
+ * CoupledDiffusionReactionSub and CoupledConvectionReactionSub kernels:
+ * sum_r weight_r * (porosity * d(C_r)/dt + diffusivity * grad(C_r) + darcy_vel . grad(C_r)),
+ * where the equilibrium concentrations C_r and their derivatives with respect to the
+ * primary species are supplied by AqueousEquilibriumSpeciation.
+ */
+class CondensedEquilibriumSub : public Kernel
+{
+public:
+  CondensedEquilibriumSub(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Jacobian contribution of the primary species with index m
+  Real computeQpPrimaryJacobian(unsigned int m);
+
+private:
+  /// Weights of the equilibrium species in the total concentration of this primary species
+  const std::vector<Real> _weights;
+
+  /// Primary species variable numbers, in the order used by AqueousEquilibriumSpeciation
+  std::vector<unsigned int> _primary_vars;
+
+  /// Index of the variable this kernel acts on in the list of primary species
+  unsigned int _u_index;
+
+  /// Material property of porosity
+  const MaterialProperty<Real> & _porosity;
+
+  /// Material property of diffusivity
+  const MaterialProperty<Real> & _diffusivity;
+
+  /// Equilibrium species concentrations and their derivatives
+  const MaterialProperty<std::vector<Real>> & _eq_conc;
+  const MaterialProperty<std::vector<Real>> & _eq_conc_old;
+  const MaterialProperty<std::vector<std::vector<Real>>> & _deq_conc_dc;
+  const MaterialProperty<std::vector<RealGradient>> & _grad_eq_conc;
+  const MaterialProperty<std::vector<std::vector<RealGradient>>> & _dgrad_eq_conc_dc;
+
+  /// Whether convection by the pressure gradient is included
+  const bool _has_pressure;
+
+  /// Material property of hydraulic conductivity (only used with pressure)
+  const MaterialProperty<Real> * _cond;
+
+  /// Pressure gradient and variable number (only used with pressure)
+  const VariableGradient & _grad_p;
+  const unsigned int _p_var;
+};
+
+#endif // CONDENSEDEQUILIBRIUMSUB_H
@@ -0,0 +1,75 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef AQUEOUSEQUILIBRIUMSPECIATION_H
+#define AQUEOUSEQUILIBRIUMSPECIATION_H
+
+#include "Material.h"
+
+// Forward Declarations
+class AqueousEquilibriumSpeciation;
+
+template <>
+InputParameters validParams<AqueousEquilibriumSpeciation>();
+
+/**
+ * Local speciation of the aqueous equilibrium species. The concentration of every
+ * equilibrium species is eliminated in favour of the primary species through the
+ * mass action law 10^log_k * prod_i c_i^sto_i, so only the primary species enter the
+ * global system. The equilibrium concentrations, their gradients and the derivatives
+ * of both with respect to the primary species are computed once per quadrature point
+ * for use by CondensedEquilibriumSub.
+ */
+class AqueousEquilibriumSpeciation : public Material
+{
+public:
+  AqueousEquilibriumSpeciation(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+
+private:
+  /// Number of primary species
+  const unsigned int _num_primary;
+
+  /// Equilibrium constants (log10) of the equilibrium reactions
+  const std::vector<Real> _log_k;
+
+  /// Number of equilibrium reactions
+  const unsigned int _num_reactions;
+
+  /// Stoichiometric coefficients, indexed by [reaction][primary species]
+  std::vector<std::vector<Real>> _sto;
+
+  /// Primary species participating in each reaction (nonzero stoichiometric coefficient)
+  std::vector<std::vector<unsigned int>> _participants;
+
+  /// Primary species concentrations
+  std::vector<const VariableValue *> _vals;
+
+  /// Gradients of the primary species concentrations
+  std::vector<const VariableGradient *> _grad_vals;
+
+  /// Equilibrium species concentrations
+  MaterialProperty<std::vector<Real>> & _eq_conc;
+
+  /// Derivatives of the equilibrium species concentrations wrt the primary species
+  MaterialProperty<std::vector<std::vector<Real>>> & _deq_conc_dc;
+
+  /// Gradients of the equilibrium species concentrations
+  MaterialProperty<std::vector<RealGradient>> & _grad_eq_conc;
+
+  /// Derivatives of the gradients of the equilibrium species wrt the primary species values
+  MaterialProperty<std::vector<std::vector<RealGradient>>> & _dgrad_eq_conc_dc;
+
+  /// Work arrays holding c^sto and its first and second derivatives for one reaction
+  std::vector<Real> _pow;
+  std::vector<Real> _dpow;
+  std::vector<Real> _d2pow;
+};
+
+#endif // AQUEOUSEQUILIBRIUMSPECIATION_H
@@ -0,0 +1,90 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef MORTARNORMALCONTACTCONSTRAINT_H
+#define MORTARNORMALCONTACTCONSTRAINT_H
+
+#include "FaceFaceConstraint.h"
+
+class MortarNormalContactConstraint;
+
+template <>
+InputParameters validParams<MortarNormalContactConstraint>();
+
+/**
+ * Frictionless normal contact enforced with a mortar (segment-to-segment)
+ * Lagrange multiplier on a MortarInterface.  The Lagrange multiplier
+ * is the contact pressure lambda and the master_variable is the
+ * displacement component normal to the (planar) interface.  The gap is
+ * measured along the coordinate direction "component",
+ *
+ *   g = s * ((x_m + u_m) - (x_s + u_s)),
+ *
+ * where s = 1 if the slave body lies on the negative side of the
+ * interface and s = -1 otherwise.  The Karush-Kuhn-Tucker conditions
+ * lambda >= 0, g >= 0, lambda * g = 0 are replaced by the
+ * nonlinear complementarity function
+ *
+ *   C(lambda, g) = lambda - max(0, lambda - c * g) = 0,
+ *
+ * which is tested with the Lagrange multiplier shape functions, so that
+ * active and inactive parts of the interface are found by the (semi-smooth)
+ * Newton iteration instead of a separate active set loop.  The primal
+ * equations get the contact traction -s * lambda on the master side and
+ * s * lambda on the slave side.
+ */
+class MortarNormalContactConstraint : public FaceFaceConstraint
+{
+public:
+  MortarNormalContactConstraint(const InputParameters & parameters);
+
+protected:
+  /**
+   * Computes the residual of the complementarity equation of the Lagrange multiplier
+   */
+  virtual Real computeQpResidual() override;
+
+  /**
+   * Computes the contact traction terms of the primal equation on the
+   * master or slave side
+   */
+  virtual Real computeQpResidualSide(Moose::ConstraintType res_type) override;
+
+  /**
+   * Computes the Jacobian of the complementarity equation wrt the Lagrange multiplier
+   */
+  virtual Real computeQpJacobian() override;
+
+  /**
+   * Computes the Jacobian of the complementarity equation wrt the
+   * displacement (MasterMaster, MasterSlave) and of the primal equation
+   * wrt the Lagrange multiplier (SlaveMaster, SlaveSlave)
+   */
+  virtual Real computeQpJacobianSide(Moose::ConstraintJacobianType jac_type) override;
+
+  /**
+   * The gap at the current quadrature point
+   */
+  Real gap() const;
+
+  /**
+   * Whether the contact is active at the current quadrature point,
+   * i.e. the max() in the complementarity function is not zero
+   */
+  bool active() const;
+
+  /// The coordinate direction normal to the interface
+  const unsigned int _component;
+
+  /// The orientation of the gap, 1 if the slave body lies on the negative side of the interface
+  const Real _sign;
+
+  /// The complementarity parameter c
+  const Real _c;
+};
+
+#endif /* MORTARNORMALCONTACTCONSTRAINT_H */
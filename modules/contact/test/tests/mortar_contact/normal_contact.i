@@ -0,0 +1,104 @@
+# Two blocks stacked along y with a mortar interface in between. The bottom of the
+# lower (slave) block is fixed and the top of the upper (master) block is pushed
+# down by t, so the blocks are in contact and u = -t * y. At t = 2 the top is pulled
+# up to 1 and the blocks separate: u = 0 in the lower block and u = 1 in the upper one.
+# Diffusion stands in for the elasticity of a one-dimensional displacement.
+[Mesh]
+  file = 2blk-conf.e
+
+  [./MortarInterfaces]
+    [./middle]
+      master = 100
+      slave = 101
+      subdomain = 1000
+    [../]
+  [../]
+[]
+
+[Variables]
+  [./disp_y]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  [../]
+
+  [./pressure]
+    order = FIRST
+    family = LAGRANGE
+    block = middle
+  [../]
+[]
+
+[Functions]
+  [./top]
+    type = ParsedFunction
+    value = 'if(t<1.75, -t, 1)'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = disp_y
+  [../]
+[]
+
+[Constraints]
+  [./contact]
+    type = MortarNormalContactConstraint
+    variable = pressure
+    interface = middle
+    master_variable = disp_y
+    component = 1
+    c = 10
+  [../]
+[]
+
+[BCs]
+  [./bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 1
+    value = 0
+  [../]
+  [./top]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 3
+    function = top
+  [../]
+[]
+
+[Postprocessors]
+  [./slave_disp]
+    type = PointValue
+    variable = disp_y
+    point = '0.5 0.25 0'
+  [../]
+  [./master_disp]
+    type = PointValue
+    variable = disp_y
+    point = '0.5 0.75 0'
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+    solve_type = 'NEWTON'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.5
+  num_steps = 4
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+  nl_max_its = 20
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,72 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef FLUIDPROPERTIESMATERIALVE_H
+#define FLUIDPROPERTIESMATERIALVE_H
+
+#include "Material.h"
+#include "SinglePhaseFluidPropertiesPT.h"
+
+class FluidPropertiesMaterialVE;
+
+template <>
+InputParameters validParams<FluidPropertiesMaterialVE>();
+
+/**
+ * Computes fluid properties of a (pressure, temperature) formulation from specific volume and
+ * specific internal energy. The pressure and temperature are stateful, so the values of the
+ * previous evaluation at each quadrature point are kept and start the Newton iteration of
+ * SinglePhaseFluidPropertiesPT::p_T_from_v_e().
+ */
+class FluidPropertiesMaterialVE : public Material
+{
+public:
+  FluidPropertiesMaterialVE(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+
+  /// Specific volume (m^3/kg)
+  const VariableValue & _v;
+  /// Specific internal energy (J/kg)
+  const VariableValue & _e;
+
+  /// Pressure (Pa)
+  MaterialProperty<Real> & _p;
+  /// Temperature (K)
+  MaterialProperty<Real> & _T;
+  /// Old pressure and temperature, requested to make the pressure and temperature stateful
+  const MaterialProperty<Real> & _p_old;
+  const MaterialProperty<Real> & _T_old;
+
+  /// Density (kg/m^3)
+  MaterialProperty<Real> & _rho;
+  /// Viscosity (Pa.s)
+  MaterialProperty<Real> & _mu;
+  /// Isobaric specific heat capacity (J/kg/K)
+  MaterialProperty<Real> & _cp;
+  /// Isochoric specific heat capacity (J/kg/K)
+  MaterialProperty<Real> & _cv;
+  /// Thermal conductivity (W/m/K)
+  MaterialProperty<Real> & _k;
+  /// Specific enthalpy (J/kg)
+  MaterialProperty<Real> & _h;
+  /// Specific entropy (J/kg/K)
+  MaterialProperty<Real> & _s;
+  /// Speed of sound (m/s)
+  MaterialProperty<Real> & _c;
+
+  /// Initial guesses of the pressure and temperature
+  const Real _pressure_guess;
+  const Real _temperature_guess;
+
+  /// Fluid properties UserObject
+  const SinglePhaseFluidPropertiesPT & _fp;
+};
+
+#endif /* FLUIDPROPERTIESMATERIALVE_H */
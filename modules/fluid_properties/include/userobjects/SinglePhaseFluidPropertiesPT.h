@@ -76,12 +76,62 @@ public:
   h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const = 0;
   /// Thermal expansion coefficient (-)
   virtual Real beta(Real pressure, Real temperature) const = 0;
+  /// Density, internal energy and enthalpy and their derivatives wrt pressure and temperature
+  virtual void rho_e_h_dpT(Real pressure,
+                           Real temperature,
+                           Real & rho,
+                           Real & drho_dp,
+                           Real & drho_dT,
+                           Real & e,
+                           Real & de_dp,
+                           Real & de_dT,
+                           Real & h,
+                           Real & dh_dp,
+                           Real & dh_dT) const;
+  /// Density, heat capacities, enthalpy, internal energy, entropy and speed of sound
+  virtual void rho_cp_cv_h_e_s_c(Real pressure,
+                                 Real temperature,
+                                 Real & rho,
+                                 Real & cp,
+                                 Real & cv,
+                                 Real & h,
+                                 Real & e,
+                                 Real & s,
+                                 Real & c) const;
   /// Henry's law constant for dissolution in water
   virtual Real henryConstant(Real temperature) const = 0;
   /// Henry's law constant for dissolution in water and derivative wrt temperature
   virtual void henryConstant_dT(Real temperature, Real & Kh, Real & dKh_dT) const = 0;
 
+  /**
+   * Pressure and temperature from specific volume and internal energy, found by a Newton
+   * iteration on rho_e_dpT() started from an initial guess (typically the solution of the
+   * previous call at the same point)
+   * @param v specific volume (m^3/kg)
+   * @param e specific internal energy (J/kg)
+   * @param p0 initial guess of the pressure (Pa)
+   * @param T0 initial guess of the temperature (K)
+   * @param[out] pressure pressure (Pa)
+   * @param[out] temperature temperature (K)
+   */
+  virtual void p_T_from_v_e(
+      Real v, Real e, Real p0, Real T0, Real & pressure, Real & temperature) const;
+
 protected:
+  /**
+   * Limits a Newton update of p_T_from_v_e() to the range of validity of the formulation.
+   * The default keeps the pressure and temperature positive by halving them instead of
+   * stepping to non-positive values.
+   * @param pressure pressure before the update (Pa)
+   * @param temperature temperature before the update (K)
+   * @param[in,out] new_pressure updated pressure (Pa)
+   * @param[in,out] new_temperature updated temperature (K)
+   */
+  virtual void limitUpdate(Real pressure,
+                           Real temperature,
+                           Real & new_pressure,
+                           Real & new_temperature) const;
+
   /// IAPWS formulation of Henry's law constant for dissolution in water
   virtual Real henryConstantIAPWS(Real temperature, Real A, Real B, Real C) const;
   /// IAPWS formulation of Henry's law constant for dissolution in water and derivative wrt temperature
@@ -92,6 +142,10 @@ protected:
   const Real _R;
   /// Conversion of temperature from Celcius to Kelvin
   const Real _T_c2k;
+  /// Relative tolerance of the pressure and temperature in p_T_from_v_e()
+  const Real _v_e_tolerance;
+  /// Maximum number of Newton iterations in p_T_from_v_e()
+  const unsigned int _v_e_max_its;
 };
 
 #endif /* SINGLEPHASEFLUIDPROPERTIESPT_H */
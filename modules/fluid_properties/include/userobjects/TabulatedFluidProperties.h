@@ -120,6 +120,28 @@ public:
   /// Enthalpy and its derivatives wrt pressure and temperature
   virtual void
   h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
+  /// Density, internal energy and enthalpy, and derivatives wrt pressure and temperature
+  virtual void rho_e_h_dpT(Real pressure,
+                           Real temperature,
+                           Real & rho,
+                           Real & drho_dp,
+                           Real & drho_dT,
+                           Real & e,
+                           Real & de_dp,
+                           Real & de_dT,
+                           Real & h,
+                           Real & dh_dp,
+                           Real & dh_dT) const override;
+  /// Density, heat capacities, enthalpy, internal energy, entropy and speed of sound
+  virtual void rho_cp_cv_h_e_s_c(Real pressure,
+                                 Real temperature,
+                                 Real & rho,
+                                 Real & cp,
+                                 Real & cv,
+                                 Real & h,
+                                 Real & e,
+                                 Real & s,
+                                 Real & c) const override;
   /// Viscosity
   virtual Real mu(Real density, Real temperature) const override;
   /// Derivatives of viscosity wrt density and temperature
@@ -145,8 +167,17 @@ public:
   virtual Real henryConstant(Real temperature) const override;
   /// Henry's law constant for dissolution in water and derivative wrt temperature
   virtual void henryConstant_dT(Real temperature, Real & Kh, Real & dKh_dT) const override;
+  /// Pressure and temperature from specific volume and internal energy
+  virtual void p_T_from_v_e(
+      Real v, Real e, Real p0, Real T0, Real & pressure, Real & temperature) const override;
 
 protected:
+  /// Keeps the Newton updates of p_T_from_v_e() within the tabulated range
+  virtual void limitUpdate(Real pressure,
+                           Real temperature,
+                           Real & new_pressure,
+                           Real & new_temperature) const override;
+
   /**
    * Writes tabulated data to a file.
    * @param file_name name of the file to be written
@@ -163,7 +194,8 @@ protected:
 
   /**
    * Generates a table of fluid properties by looping over pressure and temperature
-   * and calculating properties using the FluidProperties UserObject _fp.
+   * and calculating properties using the FluidProperties UserObject _fp. The pressure
+   * points are distributed over the processors and the table is then summed.
    */
   virtual void generateTabulatedData();
 
@@ -146,6 +146,60 @@ public:
                          Real & de_dp,
                          Real & de_dT) const override;
 
+  /**
+   * Density, internal energy and enthalpy and their derivatives wrt pressure and
+   * temperature. The region is determined and the Gibbs (or Helmholtz) free energy
+   * and its derivatives are evaluated only once for all properties.
+   *
+   * @param pressure fluid pressure (Pa)
+   * @param temperature fluid temperature (K)
+   * @param[out] rho density (kg/m^3)
+   * @param[out] drho_dp derivative of density wrt pressure
+   * @param[out] drho_dT derivative of density wrt temperature
+   * @param[out] e internal energy (J/kg)
+   * @param[out] de_dp derivative of internal energy wrt pressure
+   * @param[out] de_dT derivative of internal energy wrt temperature
+   * @param[out] h enthalpy (J/kg)
+   * @param[out] dh_dp derivative of enthalpy wrt pressure
+   * @param[out] dh_dT derivative of enthalpy wrt temperature
+   */
+  virtual void rho_e_h_dpT(Real pressure,
+                           Real temperature,
+                           Real & rho,
+                           Real & drho_dp,
+                           Real & drho_dT,
+                           Real & e,
+                           Real & de_dp,
+                           Real & de_dT,
+                           Real & h,
+                           Real & dh_dp,
+                           Real & dh_dT) const override;
+
+  /**
+   * Density, isobaric and isochoric specific heat capacities, enthalpy, internal
+   * energy, entropy and speed of sound, sharing a single evaluation of the Gibbs
+   * (or Helmholtz) free energy and its derivatives
+   *
+   * @param pressure fluid pressure (Pa)
+   * @param temperature fluid temperature (K)
+   * @param[out] rho density (kg/m^3)
+   * @param[out] cp isobaric specific heat (J/kg/K)
+   * @param[out] cv isochoric specific heat (J/kg/K)
+   * @param[out] h enthalpy (J/kg)
+   * @param[out] e internal energy (J/kg)
+   * @param[out] s entropy (J/kg/K)
+   * @param[out] c speed of sound (m/s)
+   */
+  virtual void rho_cp_cv_h_e_s_c(Real pressure,
+                                 Real temperature,
+                                 Real & rho,
+                                 Real & cp,
+                                 Real & cv,
+                                 Real & h,
+                                 Real & e,
+                                 Real & s,
+                                 Real & c) const override;
+
   /**
    * Speed of sound
    *
@@ -648,6 +702,69 @@ protected:
    */
   Real d2gamma5_dpitau(Real pi, Real tau) const;
 
+  /**
+   * Gibbs free energy and all of its first and second derivatives in Region 1, 2
+   * or 5, evaluated in a single pass over the coefficients
+   *
+   * @param region phase region (1, 2 or 5)
+   * @param pi reduced pressure (-)
+   * @param tau reduced temperature (-)
+   * @param[out] g Gibbs free energy (-)
+   * @param[out] dg_dpi derivative of Gibbs free energy wrt pi (-)
+   * @param[out] dg_dtau derivative of Gibbs free energy wrt tau (-)
+   * @param[out] d2g_dpi2 second derivative of Gibbs free energy wrt pi (-)
+   * @param[out] d2g_dtau2 second derivative of Gibbs free energy wrt tau (-)
+   * @param[out] d2g_dpitau second derivative of Gibbs free energy wrt pi and tau (-)
+   */
+  void gibbsDerivatives(unsigned int region,
+                        Real pi,
+                        Real tau,
+                        Real & g,
+                        Real & dg_dpi,
+                        Real & dg_dtau,
+                        Real & d2g_dpi2,
+                        Real & d2g_dtau2,
+                        Real & d2g_dpitau) const;
+
+  /**
+   * Helmholtz free energy and all of its first and second derivatives in Region 3,
+   * evaluated in a single pass over the coefficients
+   *
+   * @param delta reduced density (-)
+   * @param tau reduced temperature (-)
+   * @param[out] phi Helmholtz free energy (-)
+   * @param[out] dphi_ddelta derivative of Helmholtz free energy wrt delta (-)
+   * @param[out] dphi_dtau derivative of Helmholtz free energy wrt tau (-)
+   * @param[out] d2phi_ddelta2 second derivative of Helmholtz free energy wrt delta (-)
+   * @param[out] d2phi_dtau2 second derivative of Helmholtz free energy wrt tau (-)
+   * @param[out] d2phi_ddeltatau second derivative of Helmholtz free energy wrt delta and tau (-)
+   */
+  void helmholtzDerivatives3(Real delta,
+                             Real tau,
+                             Real & phi,
+                             Real & dphi_ddelta,
+                             Real & dphi_dtau,
+                             Real & d2phi_ddelta2,
+                             Real & d2phi_dtau2,
+                             Real & d2phi_ddeltatau) const;
+
+  /**
+   * Sum of n_i * a^I_i * b^J_i and its first and second derivatives wrt a and b,
+   * evaluated with a single pair of powers per term. Terms before start are skipped.
+   */
+  void polynomialDerivatives(const std::vector<Real> & n,
+                             const std::vector<int> & I,
+                             const std::vector<int> & J,
+                             Real a,
+                             Real b,
+                             std::size_t start,
+                             Real & f,
+                             Real & df_da,
+                             Real & df_db,
+                             Real & d2f_da2,
+                             Real & d2f_db2,
+                             Real & d2f_dadb) const;
+
   /// Enum of subregion ids for region 3
   enum subregionEnum
   {
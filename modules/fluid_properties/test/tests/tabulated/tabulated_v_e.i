@@ -0,0 +1,129 @@
+# Test the inversion of TabulatedFluidProperties from specific volume and internal energy
+# using FluidPropertiesMaterialVE. The specific volume and internal energy are those of
+# the tabulated point p = 2 MPa, T = 350 K, with density = 32.1647 kg/m^3 and
+# enthalpy = 31382.3 J/kg. The initial guess p = 0.1 MPa, T = 300 K is outside the table.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+[]
+
+[Variables]
+  [./dummy]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+    initial_condition = 0.0310899837399385
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./e]
+    initial_condition = -30797.6
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./pressure]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./temperature]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./rho]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./h]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[AuxKernels]
+  [./pressure]
+    type = MaterialRealAux
+    variable = pressure
+    property = pressure
+  [../]
+  [./temperature]
+    type = MaterialRealAux
+    variable = temperature
+    property = temperature
+  [../]
+  [./rho]
+    type = MaterialRealAux
+    variable = rho
+    property = density
+  [../]
+  [./enthalpy]
+    type = MaterialRealAux
+    variable = h
+    property = h
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./co2]
+      type = CO2FluidProperties
+    [../]
+    [./tabulated]
+      type = TabulatedFluidProperties
+      fp = co2
+      fluid_property_file = fluid_properties.csv
+    [../]
+  []
+[]
+
+[Materials]
+  [./fp_mat]
+    type = FluidPropertiesMaterialVE
+    v = v
+    e = e
+    fp = tabulated
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = dummy
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
+
+[Postprocessors]
+  [./pressure]
+    type = ElementalVariableValue
+    elementid = 0
+    variable = pressure
+  [../]
+  [./temperature]
+    type = ElementalVariableValue
+    elementid = 0
+    variable = temperature
+  [../]
+  [./rho]
+    type = ElementalVariableValue
+    elementid = 0
+    variable = rho
+  [../]
+  [./h]
+    type = ElementalVariableValue
+    elementid = 0
+    variable = h
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  file_base = tabulated_v_e_out
+  execute_on = 'TIMESTEP_END'
+[]
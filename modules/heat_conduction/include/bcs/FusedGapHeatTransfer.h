@@ -0,0 +1,82 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef FUSEDGAPHEATTRANSFER_H
+#define FUSEDGAPHEATTRANSFER_H
+
+#include "IntegratedBC.h"
+#include "GapConductance.h"
+
+// Forward Declarations
+class FusedGapHeatTransfer;
+class Function;
+
+template <>
+InputParameters validParams<FusedGapHeatTransfer>();
+
+/**
+ * Quadrature point based gap heat transfer that evaluates the gap distance, the temperature
+ * across the gap and the conductance h_gap = h_conduction + h_radiation of GapConductance itself.
+ * The penetration info of each quadrature point is looked up once per side and evaluation
+ * instead of once per test and shape function, and neither a GapConductance material nor the gap
+ * aux variables are needed.
+ */
+class FusedGapHeatTransfer : public IntegratedBC
+{
+public:
+  FusedGapHeatTransfer(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeJacobianBlock(unsigned int jvar) override;
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Look up the gap values and compute the conductance at all quadrature points of the side
+  virtual void computeGapValues();
+
+  ///@{ The gap conductivity and the radiant gap conductance at _qp, as in GapConductance
+  virtual Real gapK();
+  virtual Real h_radiation();
+  ///@}
+
+  GapConductance::GAP_GEOMETRY _gap_geometry_type;
+
+  const Real _min_gap;
+  const Real _max_gap;
+
+  const Real _gap_conductivity;
+  Function * const _gap_conductivity_function;
+  const VariableValue * const _gap_conductivity_function_variable;
+
+  const Real _stefan_boltzmann;
+  Real _emissivity;
+
+  /// The displacement variables, to compute the dependence on the gap length
+  std::vector<unsigned int> _disp_vars;
+
+  PenetrationLocator & _penetration_locator;
+  const bool _warnings;
+
+  Point _p1;
+  Point _p2;
+
+  ///@{ Gap values at the quadrature points of the current side
+  std::vector<bool> _has_info;
+  std::vector<Real> _gap_temp;
+  std::vector<Real> _gap_length;
+  std::vector<Real> _edge_multiplier;
+  std::vector<Real> _conduction;
+  std::vector<Real> _conductance;
+  ///@}
+};
+
+#endif // FUSEDGAPHEATTRANSFER_H
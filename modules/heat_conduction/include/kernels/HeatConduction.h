@@ -27,10 +27,13 @@ class HeatConductionKernel : public Diffusion
 public:
   HeatConductionKernel(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
   virtual Real computeQpResidual();
 
   virtual Real computeQpJacobian();
+  virtual bool computeResidualBatch() override;
 
 private:
   const MaterialProperty<Real> & _diffusion_coefficient;
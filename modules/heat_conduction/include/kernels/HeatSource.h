@@ -19,6 +19,8 @@ class HeatSource : public BodyForce
 {
 public:
   HeatSource(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
 };
 
 #endif
@@ -0,0 +1,85 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef LEVELSETNARROWBANDINTERFACE_H
+#define LEVELSETNARROWBANDINTERFACE_H
+
+// MOOSE includes
+#include "InputParameters.h"
+#include "Kernel.h"
+#include "LevelSetNarrowBand.h"
+
+template <typename T = Kernel>
+class LevelSetNarrowBandInterface;
+
+template <>
+InputParameters validParams<LevelSetNarrowBandInterface<>>();
+
+/**
+ * A helper class that restricts a Kernel to the elements of a LevelSetNarrowBand. Outside of
+ * the band the Kernel contributes nothing, so the level set keeps the value imposed by the
+ * remaining (time derivative) Kernels.
+ */
+template <class T>
+class LevelSetNarrowBandInterface : public T
+{
+public:
+  LevelSetNarrowBandInterface(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+protected:
+  /// Returns false if a narrow band is used and the current element is outside of it
+  bool inNarrowBand() const;
+
+  /// The narrow band, nullptr if the Kernel is applied everywhere
+  const LevelSetNarrowBand * _narrow_band;
+};
+
+template <class T>
+LevelSetNarrowBandInterface<T>::LevelSetNarrowBandInterface(const InputParameters & parameters)
+  : T(parameters),
+    _narrow_band(T::isParamValid("narrow_band")
+                     ? &T::template getUserObject<LevelSetNarrowBand>("narrow_band")
+                     : nullptr)
+{
+}
+
+template <class T>
+bool
+LevelSetNarrowBandInterface<T>::inNarrowBand() const
+{
+  return !_narrow_band || _narrow_band->contains(T::_current_elem);
+}
+
+template <class T>
+void
+LevelSetNarrowBandInterface<T>::computeResidual()
+{
+  if (inNarrowBand())
+    T::computeResidual();
+}
+
+template <class T>
+void
+LevelSetNarrowBandInterface<T>::computeJacobian()
+{
+  if (inNarrowBand())
+    T::computeJacobian();
+}
+
+template <class T>
+void
+LevelSetNarrowBandInterface<T>::computeOffDiagJacobian(unsigned int jvar)
+{
+  if (inNarrowBand())
+    T::computeOffDiagJacobian(jvar);
+}
+
+#endif // LEVELSETNARROWBANDINTERFACE_H
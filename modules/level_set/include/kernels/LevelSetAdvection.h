@@ -11,6 +11,7 @@
 // MOOSE includes
 #include "Kernel.h"
 #include "LevelSetVelocityInterface.h"
+#include "LevelSetNarrowBandInterface.h"
 
 // Forward declarations
 class LevelSetAdvection;
@@ -25,7 +26,7 @@ InputParameters validParams<LevelSetAdvection>();
  * where \vec{v} is the interface velocity that is a set of
  * coupled variables.
  */
-class LevelSetAdvection : public LevelSetVelocityInterface<Kernel>
+class LevelSetAdvection : public LevelSetNarrowBandInterface<LevelSetVelocityInterface<Kernel>>
 {
 public:
   LevelSetAdvection(const InputParameters & parameters);
@@ -11,6 +11,7 @@
 // MOOSE includes
 #include "Kernel.h"
 #include "LevelSetVelocityInterface.h"
+#include "LevelSetNarrowBandInterface.h"
 
 // Forward declarations
 class LevelSetAdvectionSUPG;
@@ -21,7 +22,7 @@ InputParameters validParams<LevelSetAdvectionSUPG>();
 /**
  * SUPG stabilization for the advection portion of the level set equation.
  */
-class LevelSetAdvectionSUPG : public LevelSetVelocityInterface<Kernel>
+class LevelSetAdvectionSUPG : public LevelSetNarrowBandInterface<LevelSetVelocityInterface<Kernel>>
 {
 public:
   LevelSetAdvectionSUPG(const InputParameters & parameters);
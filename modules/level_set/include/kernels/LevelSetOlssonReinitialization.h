@@ -10,6 +10,7 @@
 
 // MOOSE includes
 #include "Kernel.h"
+#include "LevelSetNarrowBandInterface.h"
 
 // Forward declarations
 class LevelSetOlssonReinitialization;
@@ -20,7 +21,7 @@ InputParameters validParams<LevelSetOlssonReinitialization>();
 /**
  * Implements the re-initialization equation proposed by Olsson et. al. (2007).
  */
-class LevelSetOlssonReinitialization : public Kernel
+class LevelSetOlssonReinitialization : public LevelSetNarrowBandInterface<Kernel>
 {
 public:
   LevelSetOlssonReinitialization(const InputParameters & parameters);
@@ -0,0 +1,55 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef LEVELSETNARROWBAND_H
+#define LEVELSETNARROWBAND_H
+
+// MOOSE includes
+#include "ElementUserObject.h"
+
+// C++ includes
+#include <unordered_set>
+
+// Forward declarations
+class LevelSetNarrowBand;
+
+template <>
+InputParameters validParams<LevelSetNarrowBand>();
+
+/**
+ * Collects the elements within a band around the zero contour of a level set variable. The
+ * band is rebuilt every time the object executes (by default at the beginning of each time
+ * step, i.e., after the mesh has been adapted), so it follows the interface as it moves.
+ */
+class LevelSetNarrowBand : public ElementUserObject
+{
+public:
+  LevelSetNarrowBand(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  /// Returns true if the element is part of the narrow band.
+  bool contains(const Elem * elem) const;
+
+protected:
+  /// The level set variable
+  const VariableValue & _level_set;
+
+  /// The level set value defining the interface
+  const Real & _contour;
+
+  /// Half width of the band in units of the level set variable
+  const Real & _width;
+
+  /// Ids of the local elements within the band
+  std::unordered_set<dof_id_type> _band;
+};
+
+#endif // LEVELSETNARROWBAND_H
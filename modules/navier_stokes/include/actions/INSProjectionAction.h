@@ -0,0 +1,72 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef INSPROJECTIONACTION_H
+#define INSPROJECTIONACTION_H
+
+#include "Action.h"
+
+class INSProjectionAction;
+
+template <>
+InputParameters validParams<INSProjectionAction>();
+
+/**
+ * This class sets up a segregated (Chorin projection) solve for the
+ * incompressible Navier-Stokes equations from a single input block:
+ *
+ * [Modules]
+ *   [./NavierStokes]
+ *     [./Projection]
+ *       velocity = 'u v'
+ *     [../]
+ *   [../]
+ * []
+ *
+ * It adds the velocity, star velocity and pressure variables, the
+ * INSChorinPredictor/INSChorinPressurePoisson/INSChorinCorrector
+ * Kernels and a multiplicative FieldSplit preconditioner which solves
+ * the momentum predictor, the pressure Poisson equation and the
+ * velocity correction one after another.  Because the predictor does
+ * not depend on the pressure or the corrected velocity, the split is
+ * block lower-triangular and each Newton step is a projection step.
+ */
+class INSProjectionAction : public Action
+{
+public:
+  INSProjectionAction(InputParameters parameters);
+
+  virtual void act();
+
+protected:
+  void addVariables();
+  void addKernels();
+  void addBCs();
+  void addSplits();
+  void addPreconditioner();
+
+  /// Helper that couples the velocity and star velocity components into a Kernel
+  void coupleVelocities(InputParameters & params, bool star_only);
+
+  /// Helper that adds a Split with the given variables and PETSc options
+  void addSplit(const std::string & split_name,
+                const std::vector<NonlinearVariableName> & vars,
+                const std::string & prefix);
+
+  /// Corrected (end of step) velocity components
+  std::vector<NonlinearVariableName> _velocity;
+
+  /// Intermediate (star) velocity components
+  std::vector<NonlinearVariableName> _velocity_star;
+
+  /// Pressure variable
+  const NonlinearVariableName _pressure;
+
+  /// Type that we use in Actions for declaring coupling
+  typedef std::vector<VariableName> CoupledName;
+};
+
+#endif // INSPROJECTIONACTION_H
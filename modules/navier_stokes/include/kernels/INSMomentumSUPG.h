@@ -34,11 +34,24 @@ public:
   virtual ~INSMomentumSUPG() {}
 
 protected:
+  virtual void precalculateResidual();
+  virtual void precalculateJacobian();
+  virtual void precalculateOffDiagJacobian(unsigned int jvar);
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned jvar);
   virtual void computeDPGTest(Real & PG_test, Real & d_PG_test_d_vel_comp, unsigned comp);
 
+  /**
+   * Computes the stabilization coefficients at every qp of the current element.  Called once
+   * per element before the residual or Jacobian loops so that hmax() and the grid Peclet
+   * number are not recomputed for every test/shape function pair.
+   */
+  void computeStabilizationCoefficients();
+
+  /// The velocity the stabilization parameter is evaluated with at the current qp
+  RealVectorValue stabilizationVelocity();
+
   // Coupled variables
   const VariableValue & _u_vel;
   const VariableValue & _v_vel;
@@ -60,10 +73,22 @@ protected:
   // Parameters
   RealVectorValue _gravity;
   unsigned _component;
+  bool _lag_stabilization;
 
   // Material properties
   const MaterialProperty<Real> & _mu;
   const MaterialProperty<Real> & _rho;
+
+  // Old velocities, used when the stabilization parameter is lagged
+  const VariableValue & _u_vel_old;
+  const VariableValue & _v_vel_old;
+  const VariableValue & _w_vel_old;
+
+  /// PG_test = _supg_coef * U * grad_test at each qp
+  std::vector<Real> _supg_coef;
+
+  /// d(_supg_coef)/d(U_k) = U_k * _d_supg_coef at each qp
+  std::vector<Real> _d_supg_coef;
 };
 
 #endif
@@ -118,7 +118,18 @@ protected:
   // Fluid properties
   const IdealGasFluidProperties & _fp;
 
+  /// Whether tau is evaluated with the velocity from the previous time step
+  const bool _lag_stabilization;
+
+  // Old velocities, used when the stabilization parameters are lagged
+  const VariableValue & _u_vel_old;
+  const VariableValue & _v_vel_old;
+  const VariableValue & _w_vel_old;
+
 private:
+  /// The SUPG element length scale, computed once per element in computeProperties()
+  Real _elem_hsupg;
+
   // To be called from computeProperties() function to compute _hsupg
   void computeHSUPG(unsigned int qp);
 
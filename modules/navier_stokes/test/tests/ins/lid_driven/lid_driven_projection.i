@@ -0,0 +1,74 @@
+[GlobalParams]
+  gravity = '0 0 0'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 1.0
+  ymin = 0
+  ymax = 1.0
+  nx = 20
+  ny = 20
+  elem_type = QUAD4
+[]
+
+[MeshModifiers]
+  [./corner_node]
+    type = AddExtraNodeset
+    boundary = 99
+    nodes = '0'
+  [../]
+[]
+
+[Modules]
+  [./NavierStokes]
+    # Adds u, v, u_star, v_star and p along with the Chorin predictor,
+    # pressure Poisson and corrector Kernels, and solves them one after
+    # another through a multiplicative field split.
+    [./Projection]
+      velocity = 'u v'
+      pressure = p
+      predictor_type = star
+
+      # Walls and lid, (u, v) per boundary
+      velocity_boundaries = 'bottom right left top'
+      boundary_velocities = '0 0  0 0  0 0  100 0'
+
+      # With solid walls everywhere dp/dn=0 is the natural BC, pin the
+      # pressure at a corner to remove the arbitrary constant.
+      pressure_pin_boundary = 99
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./const]
+    type = GenericConstantMaterial
+    block = 0
+    prop_names = 'rho mu'
+    prop_values = '1  1'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1.e-3
+  num_steps = 10
+  solve_type = 'NEWTON'
+
+  # The pressure Poisson operator does not change between steps, reuse the
+  # Jacobian (and with it the AMG hierarchy) until the Newton iterations stall.
+  adaptive_jacobian_lag = true
+
+  line_search = 'none'
+  nl_rel_tol = 1e-5
+  nl_max_its = 10
+  l_tol = 1e-6
+  l_max_its = 100
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,53 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef ACGRGRPOLYSPARSE_H
+#define ACGRGRPOLYSPARSE_H
+
+#include "ACGrGrPoly.h"
+
+// Forward Declarations
+class ACGrGrPolySparse;
+
+template <>
+InputParameters validParams<ACGrGrPolySparse>();
+
+/**
+ * ACGrGrPoly variant that only works on the order parameters that are active on the current
+ * element. Only a few grains are present at any point in a polycrystal, so the sum over the
+ * other order parameters is computed once per quadrature point from the active ones only, and the
+ * off-diagonal Jacobian blocks of the inactive order parameters are skipped. An order parameter is
+ * active on an element if it exceeds active_threshold at any of its quadrature points.
+ */
+class ACGrGrPolySparse : public ACGrGrPoly
+{
+public:
+  ACGrGrPolySparse(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+protected:
+  virtual Real computeDFDOP(PFFunctionType type) override;
+
+  /// Computes the sum of the squares of the other order parameters at each quadrature point
+  void computeSumEtaj();
+
+  /// Returns true if the order parameter exceeds _active_threshold on the current element
+  bool isActive(unsigned int op) const;
+
+  /// Order parameters not exceeding this value on an element are inactive on it
+  const Real _active_threshold;
+
+  /// Maps coupled variable numbers to the order parameter index in _vals
+  std::map<unsigned int, unsigned int> _var_to_op;
+
+  /// Sum of the squares of the other order parameters at each quadrature point
+  std::vector<Real> _sum_etaj;
+};
+
+#endif // ACGRGRPOLYSPARSE_H
@@ -48,6 +48,9 @@ public:
 protected:
   virtual void computeProperties();
 
+  /// pack the function parameters of all quadrature points into _func_params_batch
+  void fillParameterBatch();
+
   // tasks to perform after parsing the primary function
   virtual void functionsPostParse();
 
@@ -57,6 +60,12 @@ protected:
   /// The undiffed free energy function parser object.
   ADFunctionPtr _func_F;
 
+  /// Canonical description of the parsed function, used to share compiled functions
+  std::string _func_cache_key;
+
+  /// Function parameters of all quadrature points of the current element, stored back to back
+  std::vector<Real> _func_params_batch;
+
   /// variable names used in the expression (depends on the map_mode)
   std::vector<std::string> _variable_names;
 
@@ -10,8 +10,10 @@
 #include "Coupleable.h"
 #include "GeneralPostprocessor.h"
 #include "InfixIterator.h"
+#include "MooseMesh.h"
 #include "MooseVariableDependencyInterface.h"
 #include "ZeroInterface.h"
+#include "SortedIdSet.h"
 
 #include <iterator>
 #include <list>
@@ -26,7 +28,6 @@
 
 // Forward Declarations
 class FeatureFloodCount;
-class MooseMesh;
 class MooseVariable;
 
 template <>
@@ -215,20 +216,20 @@ public:
     friend std::ostream & operator<<(std::ostream & out, const FeatureData & feature);
 
     /// Holds the ghosted ids for a feature (the ids which will be used for stitching
-    std::set<dof_id_type> _ghosted_ids;
+    SortedIdSet _ghosted_ids;
 
     /// Holds the local ids in the interior of a feature.
     /// This data structure is only maintained on the local processor
-    std::set<dof_id_type> _local_ids;
+    SortedIdSet _local_ids;
 
     /// Holds the ids surrounding the feature
-    std::set<dof_id_type> _halo_ids;
+    SortedIdSet _halo_ids;
 
     /// Holds halo ids that extend onto a non-topologically connected surface
-    std::set<dof_id_type> _disjoint_halo_ids;
+    SortedIdSet _disjoint_halo_ids;
 
     /// Holds the nodes that belong to the feature on a periodic boundary
-    std::set<dof_id_type> _periodic_nodes;
+    SortedIdSet _periodic_nodes;
 
     /// The Moose variable where this feature was found (often the "order parameter")
     std::size_t _var_index;
@@ -401,8 +402,10 @@ protected:
    * communication operations. See the comments in these routines for the exact
    * data structure layout.
    */
-  void serialize(std::string & serialized_buffer);
-  void deserialize(std::vector<std::string> & serialized_buffers);
+  void serialize(std::string & serialized_buffer,
+                 std::vector<std::list<FeatureData>> & partial_feature_sets);
+  void deserialize(std::string & serialized_buffer,
+                   std::vector<std::list<FeatureData>> & partial_feature_sets);
   ///@}
 
   /**
@@ -411,6 +414,12 @@ protected:
    */
   void mergeSets();
 
+  /**
+   * Merge the mergeable features within each map of the passed in partial feature sets. This is
+   * used by mergeSets() on the master rank and by the intermediate ranks of the merge tree.
+   */
+  void mergePartialFeatures(std::vector<std::list<FeatureData>> & partial_feature_sets);
+
   /**
    * Method for determining whether two features are mergeable. This routine exists because
    * derived classes may need to override this function rather than use the mergeable method
@@ -420,7 +429,8 @@ protected:
 
   /**
    * This routine handles all of the serialization, communication and deserialization of the data
-   * structures containing FeatureData objects.
+   * structures containing FeatureData objects. The partial features are merged up a binary tree
+   * of ranks so the master only receives and merges log2(n_procs) pre-merged buffers.
    */
   void communicateAndMerge();
 
@@ -630,7 +640,7 @@ protected:
    * The data structure which is a list of nodes that are constrained to other nodes
    * based on the imposed periodic boundary conditions.
    */
-  std::multimap<dof_id_type, dof_id_type> _periodic_node_map;
+  MooseMesh::PeriodicNodeMap _periodic_node_map;
 
   /// The set of entities on the boundary of the domain used for determining
   /// if features intersect any boundary
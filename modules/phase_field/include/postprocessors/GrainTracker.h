@@ -149,6 +149,13 @@ protected:
                                 std::vector<std::map<Node *, CacheValues>> & cache,
                                 RemapCacheMode cache_mode);
 
+  /**
+   * Finds, for each grain in _feature_sets, the (sorted) indices of the other grains whose bounding
+   * boxes intersect one of its bounding boxes. The boxes are binned on a uniform grid so that only
+   * grains sharing a bin are compared instead of all pairs.
+   */
+  void findBoundingBoxNeighbors(std::vector<std::vector<std::size_t>> & bbox_neighbors) const;
+
   /**
    * This method returns the minimum periodic distance between two vectors of bounding boxes. If the
    * bounding boxes overlap the result is always -1.0.
@@ -18,7 +18,9 @@ InputParameters validParams<DiscreteNucleationMap>();
 /**
  * This UserObject maintains a per QP map that indicates if a nucleus is
  * present or not. It effectively performs a spatial hashing of the list maintained
- * by the DiscreteNucleationInserter (and allows for spatially extended nuclei)
+ * by the DiscreteNucleationInserter (and allows for spatially extended nuclei).
+ * Nuclei are searched in a list sorted by x coordinate, so that only elements near a
+ * nucleus evaluate the distances at their quadrature points.
  */
 class DiscreteNucleationMap : public ElementUserObject
 {
@@ -28,7 +30,7 @@ public:
   virtual void initialize();
   virtual void execute();
   virtual void threadJoin(const UserObject & y);
-  virtual void finalize() {}
+  virtual void finalize();
 
   virtual void meshChanged();
 
@@ -62,11 +64,20 @@ protected:
   /// list of nuclei maintained bu the inserter object
   const DiscreteNucleationInserter::NucleusList & _nucleus_list;
 
+  /// Nucleus locations sorted by x coordinate (only used without periodicity)
+  std::vector<Point> _sorted_nuclei;
+
+  /// Buffer for the nuclei that can reach the current element
+  std::vector<Point> _candidates;
+
   ///@{
   /// Per element list with 0/1 flags indicating the presence of a nucleus
-  using NucleusMap = std::unordered_map<dof_id_type, std::vector<Real>>;
+  using NucleusMap = std::vector<std::pair<dof_id_type, std::vector<Real>>>;
   NucleusMap _nucleus_map;
   ///@}
+
+  /// Index into _nucleus_map by element id (invalid_uint for elements without nuclei)
+  std::vector<unsigned int> _elem_index;
 };
 
 #endif // DISCRETENUCLEATIONMAP_H
@@ -10,6 +10,8 @@
 #include "EulerAngleProvider.h"
 #include "EBSDAccessFunctors.h"
 
+#include <array>
+
 class EBSDReader;
 
 template <>
@@ -30,6 +32,9 @@ InputParameters validParams<EBSDReader>();
  * Phases are referred to using the numbers in the EBSD data file. In case the phase number in the
  * data file
  * starts at 1 the phase 0 will simply contain no grains.
+ *
+ * Unless crop_data is disabled each processor only stores the data points overlapping its
+ * (semilocal) elements, while the grain averages are computed from the complete file.
  */
 class EBSDReader : public EulerAngleProvider, public EBSDAccessFunctors
 {
@@ -104,17 +109,19 @@ public:
   MooseSharedPointer<EBSDAvgDataFunctor>
   getAvgDataAccessFunctor(const MooseEnum & field_name) const;
 
+  /// Iterator over (global grain id, weight) pairs
+  typedef std::vector<std::pair<unsigned int, Real>>::const_iterator GrainWeightIterator;
+
   /**
-   * Returns a map consisting of the node index followd by
-   * a vector of all grain weights for that node. Needed by ReconVarIC
+   * Returns the range of (global grain id, weight) pairs of the grains with a non-zero
+   * weight at a node, sorted by global id. Needed by PolycrystalEBSD
    */
-  const std::map<dof_id_type, std::vector<Real>> & getNodeToGrainWeightMap() const;
+  std::pair<GrainWeightIterator, GrainWeightIterator> getNodeGrainWeights(const Node & node) const;
 
   /**
-   * Returns a map consisting of the node index followd by
-   * a vector of all phase weights for that node. Needed by ReconPhaseVarIC
+   * Returns the weight of a phase at a node. Needed by ReconPhaseVarIC
    */
-  const std::map<dof_id_type, std::vector<Real>> & getNodeToPhaseWeightMap() const;
+  Real getNodePhaseWeight(const Node & node, unsigned int phase) const;
 
   /// Maps need to be updated when the mesh changes
   void meshChanged();
@@ -135,6 +142,14 @@ protected:
   /// number of additional custom data columns
   unsigned int _custom_columns;
 
+  /// only store the data overlapping the elements on this processor
+  const bool _crop_data;
+
+  ///@{ Range [lo, hi) of the cells stored in _data
+  std::array<unsigned int, 3> _crop_lo;
+  std::array<unsigned int, 3> _crop_hi;
+  ///@}
+
   /// Logically three-dimensional data indexed by geometric points in a 1D vector
   std::vector<EBSDPointData> _data;
 
@@ -150,11 +165,17 @@ protected:
   /// global ID for given phases and grains
   std::vector<std::vector<unsigned int>> _global_id;
 
-  /// Map of grain weights per node
-  std::map<dof_id_type, std::vector<Real>> _node_to_grain_weight_map;
+  /// Sorted ids of the nodes with weights
+  std::vector<dof_id_type> _node_ids;
 
-  /// Map of phase weights per node
-  std::map<dof_id_type, std::vector<Real>> _node_to_phase_weight_map;
+  /// Offsets of the grain weights of each node into _node_grain_weights
+  std::vector<std::size_t> _node_grain_offsets;
+
+  /// (global grain id, weight) pairs of all nodes
+  std::vector<std::pair<unsigned int, Real>> _node_grain_weights;
+
+  /// Phase weights of all nodes, getPhaseNum() per node
+  std::vector<Real> _node_phase_weights;
 
   /// current timestep. Maps are only rebuild on mesh change during time step zero
   const int & _time_step;
@@ -174,9 +195,18 @@ protected:
   /// Maximum grid extent
   Real _maxx, _maxy, _maxz;
 
-  /// Computes a global index in the _data array given an input *centroid* point
+  /// Computes an index in the _data array given an input *centroid* point
   unsigned indexFromPoint(const Point & p) const;
 
+  /// Computes an index in the _data array, returns false if the point is not stored locally
+  bool localIndexFromPoint(const Point & p, unsigned int & local_index) const;
+
+  /// Computes the range [lo, hi) of the cells overlapping the elements on this processor
+  void neededCells(std::array<unsigned int, 3> & lo, std::array<unsigned int, 3> & hi) const;
+
+  /// Index of a node into the flat weight arrays
+  std::size_t nodeIndex(const Node & node) const;
+
   /// Transfer the index into the _avg_data array from given index
   unsigned indexFromIndex(unsigned int var) const;
 
@@ -30,7 +30,6 @@ public:
 protected:
   const unsigned int _phase;
   const EBSDReader & _ebsd_reader;
-  const std::map<dof_id_type, std::vector<Real>> & _node_to_grain_weight_map;
 };
 
 #endif // POLYCRYSTALEBSD_H
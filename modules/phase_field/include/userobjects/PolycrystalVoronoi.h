@@ -8,6 +8,7 @@
 #define POLYCRYSTALVORONOI_H
 
 #include "PolycrystalUserObjectBase.h"
+#include "PolycrystalICTools.h"
 
 // Forward Declarations
 class PolycrystalVoronoi;
@@ -28,6 +29,9 @@ public:
   virtual unsigned int getNumGrains() const override { return _grain_num; }
 
 protected:
+  /// Builds the spatial index over the grain centers, must be called once they are placed
+  void buildCenterLocator();
+
   /// The number of grains to create
   const unsigned int _grain_num;
 
@@ -40,6 +44,9 @@ protected:
   Point _range;
 
   std::vector<Point> _centerpoints;
+
+  /// Spatial index to find the grain closest to a point
+  std::unique_ptr<PolycrystalICTools::GrainCenterLocator> _center_locator;
 };
 
 #endif // POLYCRYSTALVORONOI_H
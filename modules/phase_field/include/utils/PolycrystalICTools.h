@@ -10,6 +10,7 @@
 #include "Moose.h"
 #include "libmesh/libmesh.h"
 #include "InitialCondition.h"
+#include "KDTree.h"
 
 namespace PolycrystalICTools
 {
@@ -45,6 +46,39 @@ private:
   std::vector<T> _data;
 };
 
+/**
+ * Finds the grain center closest to a point with a k-d tree over the centers and their periodic
+ * images. The result is identical to a linear scan over all centers using
+ * MooseMesh::minPeriodicDistance (ties go to the lowest grain index).
+ */
+class GrainCenterLocator
+{
+public:
+  GrainCenterLocator(const std::vector<Point> & centerpoints,
+                     const MooseMesh & mesh,
+                     unsigned int var_num);
+
+  /**
+   * Returns the index of the center closest to \p p, or the number of centers if none is closer
+   * than \p maxsize.
+   */
+  unsigned int closestGrain(const Point & p, Real maxsize) const;
+
+protected:
+  /// Builds the list of centers and their periodic images, grain by grain
+  static std::vector<Point> periodicImages(const std::vector<Point> & centerpoints,
+                                           const MooseMesh & mesh,
+                                           unsigned int var_num);
+
+  const std::vector<Point> & _centerpoints;
+  const MooseMesh & _mesh;
+  const unsigned int _var_num;
+
+  /// Tree over all images, image i belongs to grain i / _n_images
+  const KDTree _tree;
+  const unsigned int _n_images;
+};
+
 std::vector<unsigned int> assignPointsToVariables(const std::vector<Point> & centerpoints,
                                                   const Real op_num,
                                                   const MooseMesh & mesh,
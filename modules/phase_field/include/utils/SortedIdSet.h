@@ -0,0 +1,154 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef SORTEDIDSET_H
+#define SORTEDIDSET_H
+
+#include "DataIO.h"
+
+#include "libmesh/id_types.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+/**
+ * A set of mesh entity ids stored contiguously in a sorted vector. This uses a fraction of the
+ * memory of a std::set and serializes as a single block.
+ *
+ * Ids are appended by insert(); the vector is sorted and made unique lazily the next time the ids
+ * are read, so inserting during a flood costs amortized constant time. Reading the set (begin(),
+ * end(), size(), ...) may therefore reorder the storage and invalidate previously obtained
+ * iterators when ids were inserted in between.
+ */
+class SortedIdSet
+{
+public:
+  typedef dof_id_type value_type;
+  typedef std::vector<dof_id_type>::const_iterator const_iterator;
+  typedef const_iterator iterator;
+
+  SortedIdSet() : _sorted(true) {}
+
+  template <typename InputIterator>
+  SortedIdSet(InputIterator first, InputIterator last) : SortedIdSet()
+  {
+    insert(first, last);
+  }
+
+  SortedIdSet(std::initializer_list<dof_id_type> ids) : SortedIdSet(ids.begin(), ids.end()) {}
+
+  /// Add an id to the set
+  void insert(dof_id_type id)
+  {
+    if (_sorted && !_ids.empty() && _ids.back() >= id)
+    {
+      if (_ids.back() == id)
+        return;
+      _sorted = false;
+    }
+    _ids.push_back(id);
+  }
+
+  template <typename InputIterator>
+  void insert(InputIterator first, InputIterator last)
+  {
+    for (; first != last; ++first)
+      insert(*first);
+  }
+
+  /// Replace the contents of the set with the given ids (in any order)
+  void assign(std::vector<dof_id_type> && ids)
+  {
+    _ids = std::move(ids);
+    _sorted = _ids.empty();
+  }
+
+  /// Same as insert(), allows filling the set through std::back_inserter (e.g. with std::set_union)
+  void push_back(dof_id_type id) { insert(id); }
+
+  const_iterator begin() const
+  {
+    consolidate();
+    return _ids.begin();
+  }
+
+  const_iterator end() const
+  {
+    consolidate();
+    return _ids.end();
+  }
+
+  std::size_t size() const
+  {
+    consolidate();
+    return _ids.size();
+  }
+
+  bool empty() const { return _ids.empty(); }
+
+  /// Whether the id is in the set
+  bool contains(dof_id_type id) const
+  {
+    consolidate();
+    return std::binary_search(_ids.begin(), _ids.end(), id);
+  }
+
+  void clear()
+  {
+    _ids.clear();
+    _sorted = true;
+  }
+
+  void swap(SortedIdSet & other)
+  {
+    _ids.swap(other._ids);
+    std::swap(_sorted, other._sorted);
+  }
+
+  /// Release the memory reserved beyond the stored ids
+  void shrinkToFit()
+  {
+    consolidate();
+    _ids.shrink_to_fit();
+  }
+
+  bool operator==(const SortedIdSet & rhs) const
+  {
+    consolidate();
+    rhs.consolidate();
+    return _ids == rhs._ids;
+  }
+
+private:
+  /// Sort the ids and remove duplicates
+  void consolidate() const
+  {
+    if (!_sorted)
+    {
+      std::sort(_ids.begin(), _ids.end());
+      _ids.erase(std::unique(_ids.begin(), _ids.end()), _ids.end());
+      _sorted = true;
+    }
+  }
+
+  mutable std::vector<dof_id_type> _ids;
+
+  /// Whether _ids is sorted and unique
+  mutable bool _sorted;
+};
+
+/**
+ * The set is stored in the same layout as a std::set<dof_id_type> (size followed by the ids)
+ * so existing restart files remain readable.
+ */
+template <>
+void dataStore(std::ostream & stream, SortedIdSet & set, void * context);
+template <>
+void dataLoad(std::istream & stream, SortedIdSet & set, void * context);
+
+#endif // SORTEDIDSET_H
@@ -31,6 +31,8 @@ public:
 
 protected:
   virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
   virtual Real computeQpResidual() override;
   virtual void computeResidual() override;
   virtual void computeJacobian() override;
@@ -42,6 +44,12 @@ protected:
   /// Jacobian of the Darcy part of the flux
   virtual Real darcyQpJacobian(unsigned int jvar, unsigned int ph) const;
 
+  /**
+   * Whether darcyQpJacobian is zero for PorousFlow variable pvar at the current qp for all
+   * test and shape functions. Derived classes overriding darcyQpJacobian must override this too.
+   */
+  virtual bool darcyQpJacobianVanishes(unsigned int pvar, unsigned int ph) const;
+
   /** The mobility of the fluid.  For multi-component Darcy flow
    * this is mass_fraction * fluid_density * relative_permeability / fluid_viscosity
    * @param nodenum The node-number to evaluate the mobility for
@@ -56,6 +64,9 @@ protected:
    */
   virtual Real dmobility(unsigned nodenum, unsigned phase, unsigned pvar) const;
 
+  /// The mobility of the current element, computed at most once per node and Jacobian evaluation
+  Real cachedMobility(unsigned nodenum, unsigned phase);
+
   enum class JacRes
   {
     CALCULATE_RESIDUAL = 0,
@@ -159,6 +170,17 @@ protected:
    */
   std::vector<std::vector<std::vector<Real>>> _jacobian;
 
+  /// Element the cached proto fluxes and mobilities belong to (nullptr if there is none)
+  const Elem * _cached_elem;
+
+  /// _proto_flux before the mobilities are applied, _cached_proto_flux[num_phases][num_nodes]
+  std::vector<std::vector<Real>> _cached_proto_flux;
+
+  ///@{ Nodal mobilities of the cached element and whether they have been computed yet
+  std::vector<std::vector<Real>> _cached_mobility;
+  std::vector<std::vector<bool>> _cached_mobility_known;
+  ///@}
+
   /**
    * Number of nonlinear iterations (in this timestep and this element)
    * that a node is an upwind node for a given fluid phase.
@@ -32,6 +32,8 @@ class PorousFlowFluidStateBrineCO2 : public PorousFlowFluidStateFlashBase
 public:
   PorousFlowFluidStateBrineCO2(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
   virtual void thermophysicalProperties() override;
   /**
@@ -63,6 +65,28 @@ protected:
                      Real & dxh2og_dp,
                      Real & dxh2og_dT) const;
 
+  /**
+   * Mass fractions of CO2 and brine interpolated from the table generated in
+   * initialSetup(). Trilinear interpolation of the tabulated values and
+   * derivatives is used, so the interpolated mass fractions remain monotone
+   * between grid points. Falls back to massFractions() if the state lies outside
+   * the tabulated range.
+   *
+   * Arguments are the same as massFractions()
+   */
+  void tabulatedMassFractions(Real pressure,
+                              Real temperature,
+                              Real xnacl,
+                              Real & xco2l,
+                              Real & dxco2l_dp,
+                              Real & dxco2l_dT,
+                              Real & xh2og,
+                              Real & dxh2og_dp,
+                              Real & dxh2og_dT) const;
+
+  /// Evaluates massFractions() at each point of the (pressure, temperature, xnacl) grid
+  void generateTabulatedMassFractions();
+
   /**
    * Fugacity coefficient for CO2. Eq. (B7) from Spycher, Pruess and
    * Ennis-King, CO2-H2O mixtures in the geological sequestration of CO2. I.
@@ -167,6 +191,23 @@ protected:
   const Real _Mnacl;
   /// Molar gas constant in bar cm^3 /(K mol)
   const Real _Rbar;
+  /// Flag to use tabulated mass fractions rather than calculating them at every qp
+  const bool _tabulate;
+  /// Minimum and maximum pressure of the tabulated mass fractions (Pa)
+  const Real _pressure_min;
+  const Real _pressure_max;
+  /// Minimum and maximum temperature of the tabulated mass fractions (K)
+  const Real _temperature_min;
+  const Real _temperature_max;
+  /// Minimum and maximum salt mass fraction of the tabulated mass fractions (kg/kg)
+  const Real _xnacl_min;
+  const Real _xnacl_max;
+  /// Number of pressure, temperature and salt mass fraction points in the table
+  const unsigned int _num_p;
+  const unsigned int _num_T;
+  const unsigned int _num_xnacl;
+  /// Tabulated xco2l, dxco2l_dp, dxco2l_dT, xh2og, dxh2og_dp and dxh2og_dT at each grid point
+  std::vector<std::vector<Real>> _mass_fraction_table;
 };
 
 #endif // POROUSFLOWFLUIDSTATEBRINECO2_H
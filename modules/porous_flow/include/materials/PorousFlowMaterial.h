@@ -12,6 +12,8 @@
 #include "MaterialData.h"
 #include "PorousFlowDictator.h"
 
+#include <unordered_map>
+
 // Forward Declarations
 class PorousFlowMaterial;
 
@@ -23,6 +25,10 @@ class PorousFlowMaterial : public Material
 public:
   PorousFlowMaterial(const InputParameters & parameters);
 
+  virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+
 protected:
   virtual void initStatefulProperties(unsigned int n_points) override;
   virtual void computeProperties() override;
@@ -30,6 +36,9 @@ protected:
   /// whether the derived class holds nodal values
   const bool _nodal_material;
 
+  /// whether nodal values are computed once per node and reused by all elements sharing the node
+  const bool _cache_nodal_values;
+
   /// The variable names UserObject for the PorousFlow variables
   const PorousFlowDictator & _dictator;
 
@@ -52,6 +61,23 @@ protected:
    * @return the nearest quadpoint
    */
   unsigned nearestQP(unsigned nodenum) const;
+
+private:
+  /**
+   * Copies all supplied properties at node _qp from (or into) the given slot
+   * of the nodal cache
+   */
+  void copyFromNodalCache(unsigned int slot);
+  void copyToNodalCache(unsigned int slot);
+
+  /// Number of nodes held in each block of the nodal cache
+  static const unsigned int _nodal_cache_block_size = 256;
+  /// Property ids of the supplied properties
+  std::vector<unsigned int> _supplied_prop_ids;
+  /// Cache slot of each node computed since the last residual, Jacobian or timestep setup
+  std::unordered_map<dof_id_type, unsigned int> _nodal_cache_slot;
+  /// Cached values of each supplied property, stored in blocks of _nodal_cache_block_size nodes
+  std::vector<std::vector<std::unique_ptr<PropertyValue>>> _nodal_cache;
 };
 
 #endif // POROUSFLOWMATERIAL_H
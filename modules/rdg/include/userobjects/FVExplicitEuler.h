@@ -0,0 +1,131 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef FVEXPLICITEULER_H
+#define FVEXPLICITEULER_H
+
+#include "GeneralUserObject.h"
+#include "BlockRestrictable.h"
+
+// Forward Declarations
+class FVExplicitEuler;
+class InternalSideFluxBase;
+class BoundaryFluxBase;
+
+template <>
+InputParameters validParams<FVExplicitEuler>();
+
+/**
+ * Explicit Euler update of first-order cell-centered finite volume variables
+ *
+ * Notes:
+ *
+ *   1. The cell averages are stored in CONSTANT MONOMIAL auxiliary variables, one per
+ *      component of the flux vector. Every execution advances them by one time step:
+ *      u^{n+1} = u^n - dt / V * sum_faces (F * A)
+ *
+ *   2. The cells, faces and their geometry are cached in flat lists once per mesh change.
+ *      The update then calls the `calcFlux` methods of the flux objects directly on these
+ *      lists, neither Assembly nor the DGKernel face loop are involved.
+ *
+ *   3. Cell averages of ghost neighbors are exchanged through a packed buffer
+ *      at the beginning of every execution.
+ */
+class FVExplicitEuler : public GeneralUserObject, public BlockRestrictable
+{
+public:
+  FVExplicitEuler(const InputParameters & parameters);
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void finalize();
+
+  virtual void meshChanged();
+
+protected:
+  /// build the cell and face lists and cache their geometry
+  virtual void buildFaceLists();
+
+  /// exchange the cell averages of the interface cells with the other processors
+  virtual void exchangeGhostValues();
+
+  /// the mesh
+  MooseMesh & _mesh;
+
+  /// auxiliary variables holding the cell averages, in the order of the flux components
+  std::vector<MooseVariable *> _vars;
+
+  /// number of variables
+  unsigned int _n_vars;
+
+  /// internal side flux object
+  const InternalSideFluxBase & _flux;
+
+  /// boundary flux object of every listed boundary
+  std::map<BoundaryID, const BoundaryFluxBase *> _bnd_flux;
+
+  /// true if the face lists are up to date
+  bool _face_lists_cached;
+
+  /// cells, the local cells come first followed by their ghost neighbors
+  std::vector<const Elem *> _cells;
+
+  /// number of local cells
+  unsigned int _n_local_cells;
+
+  /// cell index of every element id, invalid_uint for elements without a cell
+  std::vector<unsigned int> _cell_index;
+
+  /// volume of every local cell
+  std::vector<Real> _cell_volume;
+
+  /// dof of every variable in every local cell, indexed by cell * _n_vars + variable
+  std::vector<dof_id_type> _cell_dofs;
+
+  /// local cells that have a neighbor on another processor
+  std::vector<unsigned int> _interface_cells;
+
+  /// cell averages, indexed by cell * _n_vars + variable
+  std::vector<Real> _cell_values;
+
+  /// summed face fluxes of every cell, indexed by cell * _n_vars + variable
+  std::vector<Real> _cell_residual;
+
+  /// "left" and "right" cell of every internal face, the normal points from left to right
+  std::vector<std::pair<unsigned int, unsigned int>> _face_cells;
+
+  /// local side index of every internal face in the "left" cell
+  std::vector<unsigned int> _face_side;
+
+  /// unit normal of every internal face
+  std::vector<Point> _face_normal;
+
+  /// area of every internal face
+  std::vector<Real> _face_area;
+
+  /// cell of every boundary face
+  std::vector<unsigned int> _bnd_face_cell;
+
+  /// local side index of every boundary face
+  std::vector<unsigned int> _bnd_face_side;
+
+  /// outward unit normal of every boundary face
+  std::vector<Point> _bnd_face_normal;
+
+  /// area of every boundary face
+  std::vector<Real> _bnd_face_area;
+
+  /// flux object of every boundary face
+  std::vector<const BoundaryFluxBase *> _bnd_face_flux;
+
+  /// required data for side geometry
+  const MooseArray<Point> & _normals_face;
+  const Real & _current_elem_volume;
+  const Real & _side_volume;
+};
+
+#endif // FVEXPLICITEULER_H
@@ -38,11 +38,11 @@ public:
   virtual std::vector<RealGradient> limitElementSlope() const = 0;
 
 protected:
-  virtual void serialize(std::string & serialized_buffer);
-  virtual void deserialize(std::vector<std::string> & serialized_buffers);
+  virtual void serialize(std::vector<Real> & packed_buffer);
+  virtual void deserialize(const std::vector<Real> & packed_buffers);
 
-  /// store the updated slopes into this map indexed by element ID
-  std::map<dof_id_type, std::vector<RealGradient>> _lslope;
+  /// store the updated slopes into this vector indexed by the element slots of the reconstruction
+  std::vector<std::vector<RealGradient>> _lslope;
 
   /// option whether to include BCs
   bool _include_bc;
@@ -64,9 +64,6 @@ protected:
 
   /// the neighboring element
   const Elem *& _neighbor_elem;
-
-private:
-  static Threads::spin_mutex _mutex;
 };
 
 #endif
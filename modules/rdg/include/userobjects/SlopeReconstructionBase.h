@@ -64,36 +64,57 @@ public:
 
   virtual void meshChanged();
 
+  /// slot of an element in the element-indexed storage, invalid_uint if it has none
+  unsigned int elementSlot(dof_id_type elementid) const;
+
+  /// number of slots in the element-indexed storage
+  unsigned int numElementSlots() const { return _elem_slot_ids.size(); }
+
+  /// number of slots of local elements, which come before the slots of their ghost neighbors
+  unsigned int numLocalElementSlots() const { return _side_offset.size() - 1; }
+
 protected:
-  virtual void serialize(std::string & serialized_buffer);
-  virtual void deserialize(std::vector<std::string> & serialized_buffers);
+  /// build the element and side layout and cache the side geometry of the local elements
+  virtual void buildLayout();
+
+  /// slot of a side of a local element in the side-indexed storage
+  unsigned int sideSlot(dof_id_type elementid, unsigned int side) const;
 
-  /// store the reconstructed slopes into this map indexed by element ID
-  std::map<dof_id_type, std::vector<RealGradient>> _rslope;
+  /// slot of the side of a local element that is shared with the neighbor
+  unsigned int neighborSideSlot(dof_id_type elementid, dof_id_type neighborid) const;
 
-  /// store the average variable values into this map indexed by element ID
-  std::map<dof_id_type, std::vector<Real>> _avars;
+  virtual void serialize(std::vector<Real> & packed_buffer);
+  virtual void deserialize(const std::vector<Real> & packed_buffers);
 
-  /// store the boundary average variable values into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, std::vector<Real>> _bnd_avars;
+  /// slot of every element id, invalid_uint for elements without a slot
+  std::vector<unsigned int> _elem_slot;
 
-  /// store the side centroid into this map indexed by pair of element ID and neighbor ID
-  std::map<std::pair<dof_id_type, dof_id_type>, Point> _side_centroid;
+  /// element id of every slot
+  std::vector<dof_id_type> _elem_slot_ids;
 
-  /// store the boundary side centroid into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, Point> _bnd_side_centroid;
+  /// offset of the sides of every local element slot in the side-indexed storage
+  std::vector<unsigned int> _side_offset;
 
-  /// store the side area into this map indexed by pair of element ID and neighbor ID
-  std::map<std::pair<dof_id_type, dof_id_type>, Real> _side_area;
+  /// neighbor id across every side, DofObject::invalid_id for boundary sides
+  std::vector<dof_id_type> _side_neighbor;
 
-  /// store the boundary side area into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, Real> _bnd_side_area;
+  /// store the reconstructed slopes into this vector indexed by element slot
+  std::vector<std::vector<RealGradient>> _rslope;
 
-  /// store the side normal into this map indexed by pair of element ID and neighbor ID
-  std::map<std::pair<dof_id_type, dof_id_type>, Point> _side_normal;
+  /// store the average variable values into this vector indexed by element slot
+  std::vector<std::vector<Real>> _avars;
 
-  /// store the boundary side normal into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, Point> _bnd_side_normal;
+  /// store the boundary average variable values into this vector indexed by side slot
+  std::vector<std::vector<Real>> _bnd_avars;
+
+  /// store the side centroid into this vector indexed by side slot
+  std::vector<Point> _side_centroid;
+
+  /// store the side area into this vector indexed by side slot
+  std::vector<Real> _side_area;
+
+  /// store the side normal into this vector indexed by side slot
+  std::vector<Point> _side_normal;
 
   /// required data for face assembly
   const MooseArray<Point> & _q_point_face;
@@ -112,9 +133,6 @@ protected:
 
   /// flag to indicated if side geometry info is cached
   bool _side_geoinfo_cached;
-
-private:
-  static Threads::spin_mutex _mutex;
 };
 
 #endif
@@ -0,0 +1,76 @@
+############################################################
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 100
+[]
+############################################################
+[Functions]
+  [./ic_u]
+    type = PiecewiseConstant
+    axis = 0
+    direction = right
+    xy_data = '0.1 0.5
+               0.6 1.0
+               1.0 0.5'
+  [../]
+[]
+############################################################
+[UserObjects]
+
+  [./internal_side_flux]
+    type = AEFVUpwindInternalSideFlux
+    execute_on = 'linear'
+  [../]
+
+  [./free_outflow_bc]
+    type = AEFVFreeOutflowBoundaryFlux
+    execute_on = 'linear'
+  [../]
+
+  [./explicit_euler]
+    type = FVExplicitEuler
+    variables = 'u'
+    flux = internal_side_flux
+    boundary_list = 'left right'
+    boundary_flux_list = 'free_outflow_bc free_outflow_bc'
+  [../]
+[]
+############################################################
+[AuxVariables]
+  [./u]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+############################################################
+[ICs]
+  [./u_ic]
+    type = FunctionIC
+    variable = 'u'
+    function = ic_u
+  [../]
+[]
+############################################################
+[Problem]
+  solve = false
+[]
+############################################################
+[Executioner]
+  type = Transient
+
+  start_time = 0.0
+  num_steps = 4 # 4 | 400 for complete run
+  dt = 5e-4
+[]
+
+[Outputs]
+  [./Exodus]
+    type = Exodus
+    file_base = 1d_aefv_square_wave_explicit_euler_out
+    interval = 2
+  [../]
+[]
+############################################################
@@ -29,6 +29,10 @@ public:
 
   virtual Real value(Real t, const Point & pt);
 
+  /// Evaluates value() at each point rather than the parsed function
+  virtual void
+  valueBatch(Real t, const MooseArray<Point> & points, std::vector<Real> & values) override;
+
 protected:
   /// central difference direction
   RealVectorValue _direction;
@@ -71,6 +71,13 @@ protected:
    */
   void computePandSeff();
 
+  /**
+   * evaluates the density and relative permeability user objects
+   * for all quadpoints of the element at once, using their batched
+   * (and possibly tabulated) interface.  Must be called after computePandSeff
+   */
+  void computeBatchedUOValues();
+
   /**
    * Computes the "derived" quantities --- those that
    * depend on porepressure(s) and effective saturation(s) ---
@@ -201,6 +208,22 @@ private:
   /// d^2(relperm_i)/dP_j/dP_k - used in various derivative calculations
   std::vector<std::vector<std::vector<Real>>> _d2rel_perm_dv;
 
+  ///@{
+  /// density, relperm and their derivatives from computeBatchedUOValues, indexed [phase][qp]
+  std::vector<std::vector<Real>> _uo_density_old;
+  std::vector<std::vector<Real>> _uo_density;
+  std::vector<std::vector<Real>> _uo_ddensity;
+  std::vector<std::vector<Real>> _uo_d2density;
+  std::vector<std::vector<Real>> _uo_relperm;
+  std::vector<std::vector<Real>> _uo_drelperm;
+  std::vector<std::vector<Real>> _uo_d2relperm;
+  ///@}
+
+  /// scratch storage for computeBatchedUOValues
+  std::vector<Real> _uo_arg;
+  std::vector<Real> _uo_scratch1;
+  std::vector<Real> _uo_scratch2;
+
   std::vector<const VariableValue *> _pressure_vals;
   std::vector<const VariableValue *> _pressure_old_vals;
   std::vector<const VariableGradient *> _grad_p;
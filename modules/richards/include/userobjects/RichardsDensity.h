@@ -9,6 +9,7 @@
 #define RICHARDSDENSITY_H
 
 #include "GeneralUserObject.h"
+#include "RichardsMonotoneTable.h"
 
 class RichardsDensity;
 
@@ -29,6 +30,9 @@ public:
   void execute();
   void finalize();
 
+  /// Builds the lookup table if the user asked for one
+  virtual void initialSetup() override;
+
   /**
    * fluid density as a function of porepressure
    * This must be over-ridden in derived classes to provide an actual value
@@ -49,6 +53,36 @@ public:
    * @param p porepressure
    */
   virtual Real d2density(Real p) const = 0;
+
+  /**
+   * fluid density and its first and second derivatives at a batch of porepressures.
+   * This uses the lookup table when tabulate = true, falling back to density, ddensity
+   * and d2density outside of the tabulated range or where the table does not meet the
+   * tolerance.
+   * @param p porepressures
+   * @param dens densities (resized to p.size())
+   * @param ddens derivatives of density wrt porepressure
+   * @param d2dens second derivatives of density wrt porepressure
+   * @param compute_d2 if false, d2dens is only computed where the table is used
+   */
+  void densityBatch(const std::vector<Real> & p,
+                    std::vector<Real> & dens,
+                    std::vector<Real> & ddens,
+                    std::vector<Real> & d2dens,
+                    bool compute_d2 = true) const;
+
+protected:
+  /// whether to tabulate the density
+  const bool _tabulate;
+
+  /// relative tolerance of the lookup table
+  const Real _table_tol;
+
+  /// maximum number of intervals in the lookup table
+  const unsigned int _table_max_intervals;
+
+  /// lookup table of density
+  RichardsMonotoneTable _table;
 };
 
 #endif // RICHARDSDENSITY_H
@@ -9,6 +9,7 @@
 #define RICHARDSRELPERM_H
 
 #include "GeneralUserObject.h"
+#include "RichardsMonotoneTable.h"
 
 class RichardsRelPerm;
 
@@ -28,6 +29,9 @@ public:
   void execute();
   void finalize();
 
+  /// Builds the lookup table if the user asked for one
+  virtual void initialSetup() override;
+
   /**
    * relative permeability as a function of effective saturation
    * This must be over-ridden in your derived class to provide actual
@@ -51,6 +55,35 @@ public:
    * @param seff effective saturation
    */
   virtual Real d2relperm(Real seff) const = 0;
+
+  /**
+   * relative permeability and its first and second derivatives at a batch of effective
+   * saturations.  This uses the lookup table when tabulate = true, falling back to
+   * relperm, drelperm and d2relperm where the table does not meet the tolerance.
+   * @param seff effective saturations
+   * @param kr relative permeabilities (resized to seff.size())
+   * @param dkr derivatives of relative permeability wrt effective saturation
+   * @param d2kr second derivatives of relative permeability wrt effective saturation
+   * @param compute_d2 if false, d2kr is only computed where the table is used
+   */
+  void relpermBatch(const std::vector<Real> & seff,
+                    std::vector<Real> & kr,
+                    std::vector<Real> & dkr,
+                    std::vector<Real> & d2kr,
+                    bool compute_d2 = true) const;
+
+protected:
+  /// whether to tabulate the relative permeability
+  const bool _tabulate;
+
+  /// relative tolerance of the lookup table
+  const Real _table_tol;
+
+  /// maximum number of intervals in the lookup table
+  const unsigned int _table_max_intervals;
+
+  /// lookup table of relperm over 0 <= seff <= 1
+  RichardsMonotoneTable _table;
 };
 
 #endif // RICHARDSRELPERM_H
@@ -0,0 +1,89 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef RICHARDSMONOTONETABLE_H
+#define RICHARDSMONOTONETABLE_H
+
+#include "MooseTypes.h"
+
+// C++ includes
+#include <functional>
+#include <vector>
+
+/**
+ * Piecewise cubic Hermite table of a function of one variable on a uniform grid.
+ * The nodal slopes are the exact derivatives of the tabulated function, limited
+ * with the Fritsch-Carlson conditions so the table is monotone wherever the nodal
+ * values are.  The grid is refined until the value and derivative errors at the
+ * interval quarter points are below a relative tolerance.  Intervals that still
+ * miss the tolerance at the maximum table size (e.g. close to a singular derivative)
+ * are flagged, and evaluate() reports them so the caller can use the exact function.
+ */
+class RichardsMonotoneTable
+{
+public:
+  RichardsMonotoneTable();
+
+  /**
+   * Builds the table
+   * @param xmin lower end of the tabulated range
+   * @param xmax upper end of the tabulated range
+   * @param f the function to tabulate
+   * @param df the derivative of f
+   * @param tol relative tolerance on the value and derivative
+   * @param max_intervals the maximum number of intervals of the table
+   */
+  void build(Real xmin,
+             Real xmax,
+             const std::function<Real(Real)> & f,
+             const std::function<Real(Real)> & df,
+             Real tol,
+             unsigned int max_intervals);
+
+  /// Whether build() has been called
+  bool built() const { return !_y.empty(); }
+
+  /**
+   * Evaluates the table and its first two derivatives at x
+   * @return false if x is outside the table or in an interval that did not meet the
+   * tolerance, in which case f, df and d2f are not set
+   */
+  bool evaluate(Real x, Real & f, Real & df, Real & d2f) const;
+
+  /// The number of intervals in the table
+  unsigned int numIntervals() const { return _exact.size(); }
+
+  /// The number of intervals that fall back to the exact function
+  unsigned int numExactIntervals() const;
+
+protected:
+  /// Fills _y and _m at n + 1 uniformly spaced points and limits the slopes
+  void fill(unsigned int n,
+            const std::function<Real(Real)> & f,
+            const std::function<Real(Real)> & df);
+
+  /// Evaluates the cubic in interval k at local coordinate t in [0, 1]
+  void evaluateInterval(unsigned int k, Real t, Real & f, Real & df, Real & d2f) const;
+
+  Real _xmin;
+  Real _xmax;
+
+  /// Interval width and its inverse
+  Real _h;
+  Real _inv_h;
+
+  /// Nodal values
+  std::vector<Real> _y;
+
+  /// Nodal slopes (after limiting)
+  std::vector<Real> _m;
+
+  /// Intervals that did not meet the tolerance
+  std::vector<bool> _exact;
+};
+
+#endif // RICHARDSMONOTONETABLE_H
@@ -84,6 +84,8 @@ protected:
   bool _get_equivalent_k;
   bool _use_displaced_mesh;
   bool _output_q;
+  /// Compute all integrals with a single CrackFrontDomainIntegrals object
+  bool _single_sweep;
   std::vector<unsigned int> _ring_vec;
 };
 
@@ -33,6 +33,36 @@ public:
   static std::vector<MooseEnum> getSIFModesVec(unsigned int n);
   static MooseEnum getSIFModesEnum();
 
+  enum SIF_MODE
+  {
+    KI,
+    KII,
+    KIII,
+    T
+  };
+
+  /**
+   * Auxiliary fields of a unit stress intensity factor of the given mode at the point (r, theta)
+   * in crack front coordinates (plane strain).
+   */
+  static void computeAuxFields(const SIF_MODE sif_mode,
+                               const Real r,
+                               const Real theta,
+                               const Real poissons_ratio,
+                               const Real youngs_modulus,
+                               ColumnMajorMatrix & stress,
+                               ColumnMajorMatrix & disp,
+                               ColumnMajorMatrix & grad_disp,
+                               ColumnMajorMatrix & strain);
+
+  /// Auxiliary fields of a unit T-stress at the point (r, theta) in crack front coordinates
+  static void computeTFields(const Real r,
+                             const Real theta,
+                             const Real poissons_ratio,
+                             const Real youngs_modulus,
+                             ColumnMajorMatrix & stress,
+                             ColumnMajorMatrix & grad_disp);
+
 protected:
   virtual void computeQpProperties();
 
@@ -54,14 +84,6 @@ protected:
   MaterialProperty<ColumnMajorMatrix> & _aux_grad_disp_T;
   MaterialProperty<ColumnMajorMatrix> & _aux_strain_T;
 
-  enum SIF_MODE
-  {
-    KI,
-    KII,
-    KIII,
-    T
-  };
-
   void computeAuxFields(const SIF_MODE sif_mode,
                         ColumnMajorMatrix & stress,
                         ColumnMajorMatrix & disp,
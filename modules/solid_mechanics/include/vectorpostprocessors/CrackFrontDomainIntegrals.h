@@ -0,0 +1,115 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef CRACKFRONTDOMAININTEGRALS_H
+#define CRACKFRONTDOMAININTEGRALS_H
+
+#include "ElementVectorPostprocessor.h"
+#include "CrackFrontDefinition.h"
+#include "InteractionIntegralAuxFields.h"
+#include "SymmTensor.h"
+
+// Forward Declarations
+class CrackFrontDomainIntegrals;
+
+template <>
+InputParameters validParams<CrackFrontDomainIntegrals>();
+
+/**
+ * This vector postprocessor computes the J-integral and the interaction integrals at all crack
+ * front points and for all rings in a single sweep over the elements. The q function is
+ * evaluated on the fly from the CrackFrontDefinition, and an element only contributes to the
+ * points whose integration domain it overlaps. The material properties are evaluated once per
+ * element instead of once per point, ring and mode as with the JIntegral and InteractionIntegral
+ * postprocessors.
+ */
+class CrackFrontDomainIntegrals : public ElementVectorPostprocessor
+{
+public:
+  CrackFrontDomainIntegrals(const InputParameters & parameters);
+
+  virtual void initialSetup();
+  virtual void initialize();
+  virtual void execute();
+  virtual void threadJoin(const UserObject & y);
+  virtual void finalize();
+
+protected:
+  enum INTEGRAL
+  {
+    J_INTEGRAL,
+    INTERACTION_INTEGRAL_KI,
+    INTERACTION_INTEGRAL_KII,
+    INTERACTION_INTEGRAL_KIII,
+    INTERACTION_INTEGRAL_T
+  };
+
+  /// Adds the contributions of the current element to the integrals at one crack front point
+  void addPointIntegrals(unsigned int point_index);
+
+  /// Index into _local_integrals
+  std::size_t
+  integralIndex(unsigned int integral, unsigned int ring, unsigned int point_index) const
+  {
+    return (integral * _ring_ids.size() + ring) * _num_points + point_index;
+  }
+
+  const CrackFrontDefinition * const _crack_front_definition;
+  std::vector<INTEGRAL> _integrals;
+  /// The interaction integral mode for each of the _integrals
+  std::vector<InteractionIntegralAuxFields::SIF_MODE> _sif_modes;
+  bool _has_interaction_integral;
+  std::vector<unsigned int> _ring_ids;
+  MooseEnum _q_function_type;
+  bool _treat_as_2d;
+  bool _has_symmetry_plane;
+  bool _convert_J_to_K;
+  Real _poissons_ratio;
+  Real _youngs_modulus;
+  unsigned int _num_points;
+
+  ///@{ J-integral material properties
+  const MaterialProperty<ColumnMajorMatrix> * _Eshelby_tensor;
+  const MaterialProperty<RealVectorValue> * _J_thermal_term_vec;
+  ///@}
+
+  ///@{ Interaction integral fields
+  const MaterialProperty<SymmTensor> * _stress;
+  const MaterialProperty<SymmTensor> * _strain;
+  const VariableGradient & _grad_disp_x;
+  const VariableGradient & _grad_disp_y;
+  const VariableGradient & _grad_disp_z;
+  const bool _has_temp;
+  const VariableGradient & _grad_temp;
+  const MaterialProperty<Real> * _current_instantaneous_thermal_expansion_coef;
+  ///@}
+
+  ///@{ Output vectors
+  VectorPostprocessorValue & _point_id;
+  VectorPostprocessorValue & _x;
+  VectorPostprocessorValue & _y;
+  VectorPostprocessorValue & _z;
+  /// Integral values by integral and ring, one entry per crack front point
+  std::vector<std::vector<VectorPostprocessorValue *>> _values;
+  ///@}
+
+  /// Integrals accumulated on this thread, see integralIndex()
+  std::vector<Real> _local_integrals;
+
+  /// First order Lagrange shape functions for the q function
+  UniquePtr<FEBase> _fe;
+  unsigned int _fe_dim;
+
+  /// q function at the nodes of the current element for each ring
+  std::vector<std::vector<Real>> _q;
+
+  ///@{ Auxiliary fields at the current qp for each interaction integral
+  std::vector<ColumnMajorMatrix> _aux_stress;
+  std::vector<ColumnMajorMatrix> _aux_grad_disp;
+  ///@}
+};
+
+#endif // CRACKFRONTDOMAININTEGRALS_H
@@ -45,12 +45,29 @@ protected:
    */
   void addControlParameter(const std::string & name, const Real & value);
 
-  /// Storage for the parameters to control
-  std::map<std::string, Real> _parameters;
+  /**
+   * Replaces the list of parameters to modify, the parameters stay bound when the names do not
+   * change (e.g., for every sample of the same Sampler)
+   */
+  void setControlParameters(const std::vector<std::string> & names,
+                            const std::vector<Real> & values);
+
+  ///@{
+  /// Storage for the parameters to control, later entries overwrite earlier ones of the same name
+  std::vector<std::string> _names;
+  std::vector<Real> _values;
+  ///@}
+
+  /// Handles of all parameters controlled so far, by name
+  std::map<std::string, ControllableParameter<Real>> _controllable_parameters;
+
+  /// Handles of the parameters in _names
+  std::vector<ControllableParameter<Real> *> _bound_parameters;
 
   /// Allows the SamplerTransfer to call the reset and addControlParameter methods, which
   /// should only be called by that object so making the public is dangerous.
   friend class SamplerTransfer;
+  friend class SamplerMultiApp;
 };
 
 #endif
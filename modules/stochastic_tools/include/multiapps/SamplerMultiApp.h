@@ -13,6 +13,8 @@
 #include "SamplerInterface.h"
 
 class SamplerMultiApp;
+class SamplerReceiver;
+class Backup;
 
 template <>
 InputParameters validParams<SamplerMultiApp>();
@@ -22,9 +24,87 @@ class SamplerMultiApp : public TransientMultiApp, public SamplerInterface
 public:
   SamplerMultiApp(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+  virtual void advanceStep() override;
+  virtual bool needsRestoration() override;
+  virtual void resetApp(unsigned int global_app, Real time) override;
+  virtual void postExecute() override;
+  virtual bool isSolved() const override { return _solved; }
+  virtual Real computeDT() override;
+  virtual Real appPostprocessorValue(unsigned int app, const std::string & name) override;
+
+  /**
+   * Return true when a single sub-application per processor is reused for all the local samples.
+   */
+  bool isBatchReset() const { return _batch_reset; }
+
+  /**
+   * Store the Control values for a sub-application, in "batch-reset" mode these are applied to the
+   * SamplerReceiver just before the solve of that sample.
+   * @param global_app The global sub-app index
+   * @param receiver The SamplerReceiver on the pooled sub-application
+   * @param values The parameter names and values for the sample
+   */
+  void setBatchControls(unsigned int global_app,
+                        SamplerReceiver * receiver,
+                        const std::map<std::string, Real> & values);
+
+  /**
+   * Store the SamplerReceiver and the parameters it controls, with "dynamic" scheduling the
+   * values are computed from the Sampler for each sample handed out to this processor.
+   * @param receiver The SamplerReceiver on the pooled sub-application
+   * @param parameter_names The parameters to control, one for each Sampler column
+   */
+  void setBatchReceiver(SamplerReceiver * receiver,
+                        const std::vector<std::string> & parameter_names);
+
+  /**
+   * Return true when the samples are handed out to the processors as they finish solving.
+   */
+  bool isDynamic() const { return _dynamic; }
+
 protected:
   /// Sampler to utilize for creating MultiApps
   Sampler & _sampler;
+
+  /// Flag for reusing a single sub-application for all the local samples
+  const bool _batch_reset;
+
+  /// The state of the pooled sub-application prior to the first solve ("batch-reset" mode)
+  std::shared_ptr<Backup> _batch_backup;
+
+  /// The SamplerReceiver and the values to apply for each local sample ("batch-reset" mode)
+  std::vector<std::pair<SamplerReceiver *, std::map<std::string, Real>>> _batch_controls;
+
+  /// Flag indicating that all the samples have been solved ("batch-reset" mode)
+  bool _solved;
+
+  /// Flag for handing out the samples on demand ("dynamic" scheduling)
+  const bool _dynamic;
+
+  /// The SamplerReceiver and the parameters it controls ("dynamic" scheduling)
+  SamplerReceiver * _batch_receiver;
+  const std::vector<std::string> * _batch_parameter_names;
+
+  /// The Postprocessor values of the pooled app after each sample ("dynamic" scheduling)
+  std::map<std::string, std::vector<Real>> _sample_postprocessors;
+
+private:
+  /**
+   * Solve the samples as they are handed out by the first processor.
+   */
+  bool solveDynamic();
+
+  /**
+   * Return the next sample to solve from the counter on the first processor.
+   */
+  unsigned int nextDynamicSample(MPI_Win window);
+
+  /**
+   * Apply the Control values of a sample to the pooled app and solve it.
+   */
+  bool solveSample(SamplerReceiver * receiver, const std::map<std::string, Real> & values);
 };
 
 #endif
@@ -36,7 +36,10 @@ public:
 protected:
   enum SystemEnum
   {
-    SYNCTIMES
+    SYNCTIMES,
+    FIRED_FRACTION,
+    EVER_FIRED_FRACTION,
+    MEAN_EVENTS
   };
 
   const StateSimRunner & _state_sim_runner_ptr;
@@ -24,9 +24,15 @@ public:
 
 protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
+  virtual std::vector<dof_id_type> sampleRowCounts() override;
+  virtual void sampleRowSetUp() override;
+  virtual void sampleRow(unsigned int matrix, dof_id_type row, std::vector<Real> & data) override;
 
   /// Number of monte carlo samples to create for each distribution
   const std::size_t _num_samples;
+
+  /// The row the random number generator is at when computing single rows
+  dof_id_type _generator_row;
 };
 
 #endif /* MONTECARLOSAMPLER_H */
@@ -26,6 +26,9 @@ protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
   virtual void sampleSetUp() override;
   virtual void sampleTearDown() override;
+  virtual std::vector<dof_id_type> sampleRowCounts() override;
+  virtual void sampleRowSetUp() override;
+  virtual void sampleRow(unsigned int matrix, dof_id_type row, std::vector<Real> & data) override;
 
   /// Number of Monte Carlo samples to create for each Sobol matrix
   const std::size_t _num_samples;
@@ -35,6 +38,18 @@ protected:
   DenseMatrix<Real> _a_matrix;
   DenseMatrix<Real> _b_matrix;
   ///@}
+
+  ///@{
+  /// The matrix and row the random number generators are at when computing single rows
+  unsigned int _generator_matrix;
+  dof_id_type _generator_row;
+  ///@}
+
+  ///@{
+  /// The current rows of the A and B matrices when computing single rows
+  std::vector<Real> _a_row;
+  std::vector<Real> _b_row;
+  ///@}
 };
 
 #endif
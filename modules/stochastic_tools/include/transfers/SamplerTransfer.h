@@ -22,6 +22,7 @@
 // Forward declarations
 class SamplerTransfer;
 class SamplerReceiver;
+class SamplerMultiApp;
 
 template <>
 InputParameters validParams<SamplerTransfer>();
@@ -39,9 +40,9 @@ protected:
   /**
    * Return the SamplerReceiver object and perform error checking.
    * @param app_index The global sup-app index
+   * @param num_cols The number of columns in the Sampler data
    */
-  SamplerReceiver * getReceiver(unsigned int app_index,
-                                const std::vector<DenseMatrix<Real>> & samples);
+  SamplerReceiver * getReceiver(unsigned int app_index, unsigned int num_cols);
 
   /// Storage for the list of parameters to control
   const std::vector<std::string> & _parameter_names;
@@ -49,11 +50,11 @@ protected:
   /// Pointer to the Sampler object used by the SamplerMultiApp
   Sampler * _sampler_ptr;
 
+  /// The SamplerMultiApp receiving the data
+  SamplerMultiApp * _sampler_multi_app;
+
   /// The name of the SamplerReceiver Control object on the sub-application
   const std::string & _receiver_name;
-
-  /// The matrix and row for each MultiApp
-  std::vector<std::pair<unsigned int, unsigned int>> _multi_app_matrix_row;
 };
 
 #endif // MULTIAPPCOPYTRANSFER_H
@@ -0,0 +1,54 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef GAUSSIANPROCESSSURROGATE_H
+#define GAUSSIANPROCESSSURROGATE_H
+
+#include "SurrogateModel.h"
+
+class GaussianProcessSurrogate;
+
+template <>
+InputParameters validParams<GaussianProcessSurrogate>();
+
+/**
+ * The mean of a Gaussian process with a squared exponential covariance, conditioned on the
+ * training samples. With a vanishing noise variance this is the interpolation of the results
+ * with Gaussian radial basis functions centered at the samples.
+ */
+class GaussianProcessSurrogate : public SurrogateModel
+{
+public:
+  GaussianProcessSurrogate(const InputParameters & parameters);
+
+protected:
+  virtual void train(const std::vector<std::vector<Real>> & x,
+                     const std::vector<Real> & y) override;
+  virtual Real evaluateScaled(const std::vector<Real> & x) const override;
+  virtual void writeModel(std::ostream & out) const override;
+  virtual void readModel(std::istream & in) override;
+
+  /// The covariance of the scaled points a and b
+  Real covariance(const std::vector<Real> & a, const std::vector<Real> & b) const;
+
+  /// The correlation length in the scaled coordinates
+  Real _length_scale;
+
+  /// The variance of the noise on the training results (regularizes the fit)
+  const Real _noise_variance;
+
+  /// The mean of the training results
+  Real _mean;
+
+  /// The scaled training points
+  std::vector<std::vector<Real>> _points;
+
+  /// The weights of the covariances with the training points
+  std::vector<Real> _weights;
+};
+
+#endif // GAUSSIANPROCESSSURROGATE_H
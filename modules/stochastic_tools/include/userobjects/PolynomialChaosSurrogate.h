@@ -0,0 +1,51 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef POLYNOMIALCHAOSSURROGATE_H
+#define POLYNOMIALCHAOSSURROGATE_H
+
+#include "SurrogateModel.h"
+
+class PolynomialChaosSurrogate;
+
+template <>
+InputParameters validParams<PolynomialChaosSurrogate>();
+
+/**
+ * A polynomial chaos expansion in products of Legendre polynomials (the orthogonal basis of
+ * uniformly distributed inputs) up to a total order. The coefficients are fit to the training
+ * samples by least squares.
+ */
+class PolynomialChaosSurrogate : public SurrogateModel
+{
+public:
+  PolynomialChaosSurrogate(const InputParameters & parameters);
+
+protected:
+  virtual void train(const std::vector<std::vector<Real>> & x,
+                     const std::vector<Real> & y) override;
+  virtual Real evaluateScaled(const std::vector<Real> & x) const override;
+  virtual void writeModel(std::ostream & out) const override;
+  virtual void readModel(std::istream & in) override;
+
+  /// Build the multi-indices of all products of total order up to _order in n_inputs variables
+  void buildBasis(unsigned int n_inputs);
+
+  /// Evaluate all basis functions at the scaled point x
+  void evaluateBasis(const std::vector<Real> & x, std::vector<Real> & values) const;
+
+  /// The maximum total order of the expansion
+  unsigned int _order;
+
+  /// The Legendre order of each input in each basis function
+  std::vector<std::vector<unsigned int>> _basis;
+
+  /// The expansion coefficients
+  std::vector<Real> _coefficients;
+};
+
+#endif // POLYNOMIALCHAOSSURROGATE_H
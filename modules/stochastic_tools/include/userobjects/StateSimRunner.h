@@ -32,11 +32,47 @@ public:
   Real getValue() const;
   // Real getValue() const { return 0; }
 
+  /// Whether an ensemble of trajectories is simulated
+  bool isEnsemble() const { return _ensemble_size > 0; }
+
+  ///@{
+  /**
+   * Statistics of the ensemble: the fraction of the trajectories with an event in the current
+   * time step, the fraction that had an event up to now and the mean number of events per
+   * trajectory up to now.
+   */
+  Real firedFraction() const;
+  Real everFiredFraction() const;
+  Real meanEvents() const;
+  ///@}
+
 protected:
   std::string _model_path;
   StateProcessor _state_sim;
   unsigned int _next_state_time;
   bool _ran_state_sim;
+
+  /// Generate the event times of the trajectories owned by this processor
+  void initializeEnsemble(unsigned int seed, unsigned int max_time_step);
+
+  /// Number of trajectories of the ensemble (zero for the single StateProcessor trajectory)
+  const dof_id_type _ensemble_size;
+
+  ///@{
+  /**
+   * Event times of the local trajectories, sorted and stored contiguously one trajectory after
+   * the other: the events of local trajectory m are [_event_begin[m], _event_begin[m + 1]).
+   * _event_next[m] is the first event that has not been processed yet.
+   */
+  std::vector<unsigned int> _event_times;
+  std::vector<std::size_t> _event_begin;
+  std::vector<std::size_t> _event_next;
+  ///@}
+
+  /// Trajectories with an event this time step, trajectories with an event up to now and
+  /// events up to now, of the local trajectories and (after finalize()) of the whole ensemble
+  std::vector<dof_id_type> _local_counts;
+  std::vector<dof_id_type> _counts;
 };
 
 #endif /* STATESIMRUNNER_H */
@@ -0,0 +1,97 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef SURROGATEMODEL_H
+#define SURROGATEMODEL_H
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+#include "SamplerInterface.h"
+
+class SurrogateModel;
+class Sampler;
+
+template <>
+InputParameters validParams<SurrogateModel>();
+
+/**
+ * Base class for surrogate models of a scalar quantity of interest.
+ *
+ * The model is trained from the rows of a Sampler (the inputs of the sub-applications run by a
+ * SamplerMultiApp) and a VectorPostprocessor vector holding one result per row (as gathered by
+ * MultiAppVectorPostprocessorTransfer). Alternatively a model written by a previous training run
+ * is read from a file. Once trained, evaluate() is cheap enough to replace the sub-application
+ * solves in large studies, see SurrogateEvaluator.
+ *
+ * The inputs are scaled to [-1, 1] with the bounds of the training samples before they are
+ * handed to the derived classes.
+ */
+class SurrogateModel : public GeneralUserObject, public SamplerInterface
+{
+public:
+  SurrogateModel(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /**
+   * Return the prediction of the model for the (unscaled) inputs \p x.
+   */
+  Real evaluate(const std::vector<Real> & x) const;
+
+  /// The number of inputs of the model
+  unsigned int numInputs() const { return _lower.size(); }
+
+  /// Whether the model has been trained or read
+  bool isTrained() const { return _trained; }
+
+protected:
+  /**
+   * Train the model from the scaled inputs \p x (one vector per sample) and results \p y.
+   */
+  virtual void train(const std::vector<std::vector<Real>> & x, const std::vector<Real> & y) = 0;
+
+  /**
+   * Return the prediction of the trained model for the scaled inputs \p x.
+   */
+  virtual Real evaluateScaled(const std::vector<Real> & x) const = 0;
+
+  ///@{
+  /**
+   * Write and read the trained data of the derived class (the scaling is handled here).
+   */
+  virtual void writeModel(std::ostream & out) const = 0;
+  virtual void readModel(std::istream & in) = 0;
+  ///@}
+
+  /// Error out if the model file could not be read
+  void checkStream(std::istream & in) const;
+
+  /// The sampler providing the training inputs (nullptr when the model is read from a file)
+  Sampler * _sampler;
+
+  /// The training results, one per sampler row
+  const VectorPostprocessorValue * _results;
+
+private:
+  /// Write the model to the model file (processor zero only)
+  void writeModelFile() const;
+
+  /// Read the model from the model file
+  void readModelFile();
+
+  /// Lower and upper bounds of each input over the training samples
+  std::vector<Real> _lower;
+  std::vector<Real> _upper;
+
+  /// Whether the model has been trained or read
+  bool _trained;
+};
+
+#endif // SURROGATEMODEL_H
@@ -26,6 +26,7 @@ public:
   SamplerData(const InputParameters & parameters);
   void virtual initialize() override;
   void virtual execute() override;
+  void virtual finalize() override;
 
   /// Storage for declared vectors
   std::vector<VectorPostprocessorValue *> _sample_vectors;
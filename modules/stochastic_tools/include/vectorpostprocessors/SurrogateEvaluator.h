@@ -0,0 +1,44 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef SURROGATEEVALUATOR_H
+#define SURROGATEEVALUATOR_H
+
+// MOOSE includes
+#include "GeneralVectorPostprocessor.h"
+#include "SamplerInterface.h"
+
+class SurrogateEvaluator;
+class SurrogateModel;
+
+template <>
+InputParameters validParams<SurrogateEvaluator>();
+
+/**
+ * Evaluates a SurrogateModel for every row of a Sampler, in place of running a sub-application
+ * per row with a SamplerMultiApp. The rows are split among the processors.
+ */
+class SurrogateEvaluator : public GeneralVectorPostprocessor, SamplerInterface
+{
+public:
+  SurrogateEvaluator(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  /// The sampler providing the inputs
+  Sampler & _sampler;
+
+  /// The model to evaluate
+  const SurrogateModel & _model;
+
+  /// The predictions, one per sampler row
+  VectorPostprocessorValue & _values;
+};
+
+#endif // SURROGATEEVALUATOR_H
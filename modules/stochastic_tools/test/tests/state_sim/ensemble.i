@@ -0,0 +1,56 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 20
+  dt = 1
+[]
+
+[UserObjects]
+  # 1000 trajectories simulated in lockstep, only their statistics are kept
+  [./cur_Sim]
+    type = StateSimRunner
+    model_path = 'path/to/model'
+    seed = 7
+    max_time_step = 20
+    ensemble_size = 1000
+  [../]
+[]
+
+[Postprocessors]
+  [./fired]
+    type = StateSimTester
+    test_type = FIRED_FRACTION
+    state_sim_runner = cur_Sim
+  [../]
+  [./ever_fired]
+    type = StateSimTester
+    test_type = EVER_FIRED_FRACTION
+    state_sim_runner = cur_Sim
+  [../]
+  [./mean_events]
+    type = StateSimTester
+    test_type = MEAN_EVENTS
+    state_sim_runner = cur_Sim
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
@@ -0,0 +1,57 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Distributions]
+  [./uniform_left]
+    type = UniformDistribution
+    lower_bound = 0
+    upper_bound = 0.5
+  [../]
+  [./uniform_right]
+    type = UniformDistribution
+    lower_bound = 1
+    upper_bound = 2
+  [../]
+[]
+
+[Samplers]
+  [./sample]
+    type = MonteCarloSampler
+    n_samples = 1000
+    distributions = 'uniform_left uniform_right'
+    execute_on = INITIAL
+  [../]
+[]
+
+[UserObjects]
+  [./model]
+    type = PolynomialChaosSurrogate
+    model_file = train_model.txt
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./predictions]
+    type = SurrogateEvaluator
+    sampler = sample
+    model = model
+    execute_on = INITIAL
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
@@ -0,0 +1,62 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Distributions]
+  [./uniform_left]
+    type = UniformDistribution
+    lower_bound = 0
+    upper_bound = 0.5
+  [../]
+  [./uniform_right]
+    type = UniformDistribution
+    lower_bound = 1
+    upper_bound = 2
+  [../]
+[]
+
+[Samplers]
+  [./sample]
+    type = MonteCarloSampler
+    n_samples = 6
+    distributions = 'uniform_left uniform_right'
+    execute_on = INITIAL
+  [../]
+[]
+
+[VectorPostprocessors]
+  # Stands in for the results gathered from a SamplerMultiApp by a
+  # MultiAppVectorPostprocessorTransfer
+  [./results]
+    type = ConstantVectorPostprocessor
+    value = '0.1 0.4 0.3 0.8 0.5 0.6'
+    execute_on = INITIAL
+  [../]
+[]
+
+[UserObjects]
+  [./model]
+    type = PolynomialChaosSurrogate
+    sampler = sample
+    results_vpp = results
+    results_vector = value
+    model_file = train_model.txt
+    execute_on = INITIAL
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
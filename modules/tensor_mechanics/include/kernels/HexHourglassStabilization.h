@@ -0,0 +1,59 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef HEXHOURGLASSSTABILIZATION_H
+#define HEXHOURGLASSSTABILIZATION_H
+
+#include "Kernel.h"
+
+// libMesh includes
+#include "libmesh/dense_matrix.h"
+
+class HexHourglassStabilization;
+
+template <>
+InputParameters validParams<HexHourglassStabilization>();
+
+/**
+ * Flanagan-Belytschko stiffness based hourglass control for HEX8 elements. Together with
+ * one-point quadrature (order CONSTANT) for the stress divergence and the strain and stress
+ * materials, it suppresses the zero energy modes of the reduced integration while evaluating the
+ * constitutive models once per element instead of eight times.
+ *
+ * The (linear) hourglass forces of one displacement component are K u, with
+ *   K_ab = Q G V (sum_c b_c . b_c) sum_alpha gamma_alpha,a gamma_alpha,b
+ * where b_a are the uniform gradients of the shape functions, gamma_alpha the hourglass shape
+ * vectors orthogonalized against the linear fields and V the element volume.
+ */
+class HexHourglassStabilization : public Kernel
+{
+public:
+  HexHourglassStabilization(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+
+protected:
+  virtual Real computeQpResidual() override { return 0.0; }
+
+  /// Build _stiffness for the current element
+  void computeStiffness();
+
+  /// The shear modulus scaling the hourglass stiffness
+  const Real _shear_modulus;
+
+  /// The hourglass stiffness coefficient Q
+  const Real _coefficient;
+
+  /// The values of the variable at the nodes of the element
+  const VariableValue & _nodal_u;
+
+  /// The hourglass stiffness of the current element
+  DenseMatrix<Real> _stiffness;
+};
+
+#endif // HEXHOURGLASSSTABILIZATION_H
@@ -39,6 +39,7 @@ protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  virtual bool computeResidualBatch() override;
 
   virtual void computeFiniteDeformJacobian();
   virtual void computeAverageGradientTest();
@@ -74,6 +75,9 @@ protected:
 
   /// Flag for volumetric locking correction
   bool _volumetric_locking_correction;
+
+  /// Whether the batched residual may be used (not in derived classes, which change the weak form)
+  bool _use_batch;
 };
 
 #endif // STRESSDIVERGENCETENSORS_H
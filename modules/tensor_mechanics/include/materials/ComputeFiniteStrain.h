@@ -31,9 +31,16 @@ private:
   enum class DecompMethod
   {
     TaylorExpansion,
-    EigenSolution
+    EigenSolution,
+    HogerCarlson
   };
 
+  /// Eigenvalues of a symmetric tensor in descending order, computed without an iterative solver
+  static void symmetricEigenvaluesClosedForm(const RankTwoTensor & a, Real c[3]);
+
+  /// First divided difference (log(a) - log(b)) / (2 (a - b)), the derivative for a == b
+  static Real halfLogDividedDifference(Real a, Real b);
+
   const DecompMethod _decomposition_method;
 };
 
@@ -142,6 +142,9 @@ protected:
   /// the consistent tangent operators computed by each plastic model
   std::vector<RankFourTensor> _consistent_tangent_operator;
 
+  /// the inelastic strain increments computed by each model (storage reused between qps)
+  std::vector<RankTwoTensor> _inelastic_strain_increment;
+
   /// whether to cycle through the models, using only one model per timestep
   const bool _cycle_models;
 
@@ -131,6 +131,13 @@ protected:
    */
   virtual void solveQp();
 
+  /**
+   * This function marches through the increment with substeps of adaptive size.
+   * A failed substep is halved and retried from the last converged substep,
+   * a substep that converged within half of maxiter doubles the next one.
+   */
+  virtual void solveQpAdaptiveSubsteps();
+
   /**
    * This function update stress and internal variable after solve.
    */
@@ -210,6 +217,24 @@ protected:
    */
   void calc_schmid_tensor();
 
+  /**
+   * This function calculates the resolved shear stresses _tau of all slip systems
+   * from the packed Schmid tensors.
+   */
+  void calcResolvedShearStresses(const RankTwoTensor & stress);
+
+  /**
+   * This function returns the sum of the Schmid tensors weighted by a slip system value.
+   */
+  RankTwoTensor weightedSchmidSum(const DenseVector<Real> & weight) const;
+
+  /**
+   * This function returns -_fp_old_inv * sum_i weight_i (s0_i outer s0_i),
+   * i.e. the derivative of _fp_inv with respect to the stress for slip increment
+   * derivatives given as weights.
+   */
+  RankFourTensor weightedSchmidOuterSum(const DenseVector<Real> & weight) const;
+
   /**
    * This function performs the line search update
    */
@@ -282,6 +307,9 @@ protected:
   ///Maximum number of substep iterations
   unsigned int _max_substep_iter;
 
+  ///Flag to size the substeps adaptively instead of subdividing the increment uniformly
+  bool _adaptive_substepping;
+
   ///Flag to activate line serach
   bool _use_line_search;
 
@@ -308,6 +336,8 @@ protected:
   MaterialProperty<Real> & _acc_slip;
   const MaterialProperty<Real> & _acc_slip_old;
   MaterialProperty<RankTwoTensor> & _update_rot;
+  ///Number of converged substeps of the last update
+  MaterialProperty<Real> & _substeps;
 
   const MaterialProperty<RankTwoTensor> & _deformation_gradient;
   const MaterialProperty<RankTwoTensor> & _deformation_gradient_old;
@@ -329,6 +359,9 @@ protected:
   RankTwoTensor _fe, _fp_old_inv, _fp_inv, _fp_prev_inv;
   DenseVector<Real> _slip_incr, _tau, _dslipdtau;
   std::vector<RankTwoTensor> _s0;
+  /// Schmid tensors packed by component, component (j, k) of slip system i is at
+  /// _s0_packed[(j * LIBMESH_DIM + k) * _nss + i]
+  std::vector<Real> _s0_packed;
 
   RankTwoTensor _pk2_tmp, _pk2_tmp_old;
   Real _accslip_tmp, _accslip_tmp_old;
@@ -349,6 +382,8 @@ protected:
   Real _dfgrd_scale_factor;
   ///Flags to reset variables and reinitialize variables
   bool _first_step_iter, _last_step_iter, _first_substep;
+  ///Number of Newton iterations of the last stress solve
+  unsigned int _stress_iter;
 };
 
 #endif // FINITESTRAINCRYSTALPLASTICITY_H
@@ -255,6 +255,13 @@ protected:
   DenseVector<Real> _tau;
   std::vector<MaterialProperty<std::vector<RankTwoTensor>> *> _flow_direction;
 
+  /// Flow directions of every slip rate user object packed by component, component (j, k)
+  /// of slip system s is at _flow_direction_packed[i][(j * LIBMESH_DIM + k) * nss + s]
+  std::vector<std::vector<Real>> _flow_direction_packed;
+
+  /// Slip rate derivatives of every slip rate user object
+  std::vector<std::vector<Real>> _dslipdtau;
+
   /// Flag to check whether convergence is achieved
   bool _err_tol;
 
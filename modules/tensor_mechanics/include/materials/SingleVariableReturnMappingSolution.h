@@ -105,6 +105,15 @@ private:
   /// those bounds if outside them
   bool _bracket_solution;
 
+  /**
+   * Dispatch to the current or legacy return mapping iterations.
+   * @param effective_trial_stress Effective trial stress
+   * @param scalar                 Inelastic strain increment magnitude being solved for
+   * @param iter_output            Output stream -- if null, no output is produced
+   * @return Whether the solution was successful
+   */
+  bool solve(const Real effective_trial_stress, Real & scalar, std::stringstream * iter_output);
+
   /**
    * Method called from within this class to perform the actual return mappping iterations.
    * @param effective_trial_stress Effective trial stress
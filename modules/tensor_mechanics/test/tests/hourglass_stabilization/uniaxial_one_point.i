@@ -0,0 +1,123 @@
+# Uniaxial tension of a cube of HEX8 elements integrated with a single quadrature
+# point. The hourglass control removes the zero energy modes of the reduced
+# integration and does not act on the uniform strain field, so the exact solution
+# (stress_xx = E * 0.01, disp_y = disp_z = -nu * 0.01 at the far corner) is
+# recovered.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[Modules/TensorMechanics/Master]
+  [./all]
+    strain = SMALL
+    add_variables = true
+    generate_output = 'stress_xx'
+  [../]
+[]
+
+[Kernels]
+  [./hourglass_x]
+    type = HexHourglassStabilization
+    variable = disp_x
+    shear_modulus = 3.846153846e5
+  [../]
+  [./hourglass_y]
+    type = HexHourglassStabilization
+    variable = disp_y
+    shear_modulus = 3.846153846e5
+  [../]
+  [./hourglass_z]
+    type = HexHourglassStabilization
+    variable = disp_z
+    shear_modulus = 3.846153846e5
+  [../]
+[]
+
+[BCs]
+  [./left_x]
+    type = PresetBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./bottom_y]
+    type = PresetBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./back_z]
+    type = PresetBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  [../]
+  [./right_x]
+    type = PresetBC
+    variable = disp_x
+    boundary = right
+    value = 0.01
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 1e6
+    poissons_ratio = 0.3
+  [../]
+  [./stress]
+    type = ComputeLinearElasticStress
+  [../]
+[]
+
+[Postprocessors]
+  [./stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+  [../]
+  [./disp_y]
+    type = PointValue
+    variable = disp_y
+    point = '1 1 1'
+  [../]
+  [./disp_z]
+    type = PointValue
+    variable = disp_z
+    point = '1 1 1'
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-10
+
+  [./Quadrature]
+    element_order = CONSTANT
+  [../]
+[]
+
+[Outputs]
+  execute_on = TIMESTEP_END
+  csv = true
+[]
@@ -174,9 +174,27 @@ private:
                         EFAElement3D * CEMElem,
                         std::vector<std::vector<Point>> & frag_faces) const;
 
+  /**
+   * Check whether the EFA mesh still describes the current libMesh mesh,
+   * i.e. whether it was left untouched by the last update() and the mesh
+   * topology has not been modified since.
+   */
+  bool efaMeshIsCurrent() const;
+
+  /**
+   * Record that the EFA mesh matches the current libMesh mesh topology
+   */
+  void markEFAMeshCurrent();
+
 private:
   bool _has_secondary_cut;
 
+  /// Whether _efa_mesh can be reused by the next call to update()
+  bool _efa_mesh_current;
+
+  /// Element and node counts of the mesh the EFA mesh was built from
+  std::vector<dof_id_type> _efa_mesh_topology;
+
   Xfem::XFEM_QRULE _XFEM_qrule;
 
   bool _use_crack_growth_increment;
@@ -13,6 +13,9 @@
 #include "MooseTypes.h"
 #include "XFEM.h"
 
+#include "libmesh/enum_order.h"
+#include "libmesh/enum_quadrature_type.h"
+
 using namespace libMesh;
 
 namespace libMesh
@@ -41,6 +44,11 @@ protected:
   Real _physical_volfrac;
   bool _have_weights;
   std::vector<Real> _new_weights; // quadrature weights from moment fitting
+  /// Quadrature rule the cached _new_weights were computed for
+  Xfem::XFEM_QRULE _weights_xfem_qrule;
+  QuadratureType _weights_qrule_type;
+  Order _weights_qrule_order;
+  unsigned int _weights_n_points;
   virtual Point getNodeCoordinates(EFANode * node, MeshBase * displaced_mesh = NULL) const = 0;
 
 public:
@@ -10,6 +10,9 @@
 
 #include "GeometricCutUserObject.h"
 
+// libMesh includes
+#include "libmesh/mesh_tools.h"
+
 // Forward declarations
 class GeometricCut2DUserObject;
 
@@ -52,6 +55,55 @@ protected:
                                    Real & segment_intersection_fraction) const;
 
   Real crossProduct2D(const Point & point_a, const Point & point_b) const;
+
+  /**
+   * Get the indices of the cuts active at the given time whose segments overlap the bounding
+   * box of the given points, in ascending order. The cuts are located with a bounding volume
+   * hierarchy over their segments that is rebuilt whenever the time changes.
+   */
+  void candidateCuts(const std::vector<Point> & points,
+                     Real time,
+                     std::vector<unsigned int> & cuts) const;
+
+private:
+  /// Node of the bounding volume hierarchy over the active cut segments
+  struct CutTreeNode
+  {
+    /// Bounding box of the segments of the node
+    MeshTools::BoundingBox box;
+    ///@{ Range of the node's cuts in _cut_tree_cuts
+    unsigned int begin;
+    unsigned int end;
+    ///@}
+    ///@{ Children of the node in _cut_tree, zero for a leaf
+    unsigned int left;
+    unsigned int right;
+    ///@}
+  };
+
+  /// Build the bounding volume hierarchy over the segments of the cuts active at the given time
+  void buildCutTree(Real time) const;
+
+  /// Add the node holding the cuts [begin, end) of _cut_tree_cuts and its children to the tree
+  unsigned int buildCutTreeNode(unsigned int begin, unsigned int end) const;
+
+  /// End point of the part of a cut that has grown by the time the tree was built
+  Point cutTreeEndPoint(unsigned int cut) const;
+
+  /// The nodes of the bounding volume hierarchy, the root first
+  mutable std::vector<CutTreeNode> _cut_tree;
+
+  /// The active cuts, ordered such that the cuts of each tree node are contiguous
+  mutable std::vector<unsigned int> _cut_tree_cuts;
+
+  /// The cut fractions at the time the tree was built
+  mutable std::vector<Real> _cut_tree_fractions;
+
+  /// The time the tree was built for
+  mutable Real _cut_tree_time;
+
+  /// Whether the tree has been built yet
+  mutable bool _cut_tree_built;
 };
 
 #endif // GEOMETRICCUT2DUSEROBJECT_H
@@ -0,0 +1,128 @@
+import os, re, csv, pipes
+from FileTester import FileTester
+
+class PerfTest(FileTester):
+    """
+    Runs an input, measures the requested PerformanceData events and compares them against a
+    stored baseline. A measurement that is slower than the baseline by more than the tolerances
+    is reported as a failure. Run the TestHarness with --store-perf-baselines to (re)write the
+    baselines from the current measurements.
+    """
+
+    @staticmethod
+    def validParams():
+        params = FileTester.validParams()
+        params.addRequiredParam('perf_events', [], "A list of PerformanceData events to measure (e.g. 'solve() compute_residual()').")
+        params.addParam('perf_category', 'Execution', "The PerformanceData category of the events.")
+        params.addParam('perf_column', 'total_time_with_sub', "The PerformanceData column to compare.")
+        params.addParam('perf_baseline', "The baseline file in the gold directory (default: <test name>.csv).")
+        params.addParam('perf_rel_tol', 0.25, "The allowed relative increase over the baseline.")
+        params.addParam('perf_abs_tol', 0.05, "The allowed absolute increase over the baseline, so that very short events do not fail on timer noise.")
+
+        # Timings of anything but optimized executables are meaningless
+        params.addParam('method', ['OPT'], "A test that runs under certain executable configurations ('ALL', 'OPT', 'DBG', 'DEVEL', 'OPROF', 'PRO')")
+        params.addParam('recover', False, "A test that runs with '--recover' mode enabled")
+        return params
+
+    def __init__(self, name, params):
+        FileTester.__init__(self, name, params)
+
+        # The events are measured by postprocessors added on the command line, written to their
+        # own CSV output only
+        self.perf_names = []
+        file_base = self.name() + '_perf'
+        self.specs['cli_args'].append('Outputs/perf_test/type=CSV')
+        self.specs['cli_args'].append('Outputs/perf_test/file_base=' + file_base)
+        for event in self.specs['perf_events']:
+            name = 'perf_' + re.sub(r'\W', '', event)
+            block = 'Postprocessors/' + name + '/'
+            self.specs['cli_args'] += [block + 'type=PerformanceData',
+                                       block + 'event=' + pipes.quote(event),
+                                       block + 'category=' + self.specs['perf_category'],
+                                       block + 'column=' + self.specs['perf_column'],
+                                       block + 'outputs=perf_test']
+            self.perf_names.append(name)
+        self.perf_csv = file_base + '.csv'
+
+    def getOutputFiles(self):
+        return [self.perf_csv]
+
+    def getBaselineFile(self):
+        baseline = self.name() + '.csv'
+        if self.specs.isValid('perf_baseline'):
+            baseline = self.specs['perf_baseline']
+        return os.path.join(self.specs['test_dir'], self.specs['gold_dir'], baseline)
+
+    def readMeasurements(self):
+        """ Returns the events of the final row of the CSV output, or None when it is missing """
+        filename = os.path.join(self.specs['test_dir'], self.perf_csv)
+        if not os.path.exists(filename):
+            return None
+        with open(filename) as f:
+            rows = list(csv.DictReader(f))
+        if not rows:
+            return None
+        measured = {}
+        for event, name in zip(self.specs['perf_events'], self.perf_names):
+            if name in rows[-1]:
+                measured[event] = float(rows[-1][name])
+        return measured
+
+    def writeBaseline(self, filename, measured):
+        dirname = os.path.dirname(filename)
+        if not os.path.isdir(dirname):
+            os.makedirs(dirname)
+        with open(filename, 'w') as f:
+            writer = csv.writer(f)
+            writer.writerow(['event', self.specs['perf_column']])
+            for event in self.specs['perf_events']:
+                writer.writerow([event, repr(measured[event])])
+
+    def readBaseline(self, filename):
+        with open(filename) as f:
+            return dict((row['event'], float(row[self.specs['perf_column']])) for row in csv.DictReader(f))
+
+    def processResults(self, moose_dir, retcode, options, output):
+        output = FileTester.processResults(self, moose_dir, retcode, options, output)
+
+        if self.getStatus() == self.bucket_fail or self.specs['skip_checks']:
+            return output
+
+        measured = self.readMeasurements()
+        if measured is None or len(measured) != len(self.specs['perf_events']):
+            self.setStatus('MISSING PERFORMANCE DATA', self.bucket_fail)
+            return output
+
+        baseline_file = self.getBaselineFile()
+        if options.store_perf_baselines:
+            self.writeBaseline(baseline_file, measured)
+            output += 'Stored performance baseline ' + baseline_file + '\n'
+            self.setStatus('BASELINE STORED', self.bucket_success)
+            return output
+
+        if not os.path.exists(baseline_file):
+            self.setStatus('MISSING BASELINE', self.bucket_fail)
+            return output
+
+        baseline = self.readBaseline(baseline_file)
+        rel_tol = float(self.specs['perf_rel_tol'])
+        abs_tol = float(self.specs['perf_abs_tol'])
+        regressions = []
+        output += 'Comparing performance against ' + baseline_file + '\n'
+        for event in self.specs['perf_events']:
+            if event not in baseline:
+                self.setStatus('MISSING BASELINE', self.bucket_fail)
+                return output
+            value = measured[event]
+            allowed = baseline[event] * (1. + rel_tol) + abs_tol
+            output += '  %s: %g (baseline %g, allowed %g)\n' % (event, value, baseline[event], allowed)
+            if value > allowed:
+                regressions.append(event)
+
+        if regressions:
+            output += 'Performance regression in: ' + ', '.join(regressions) + '\n'
+            self.setStatus('PERF REGRESSION', self.bucket_fail)
+            return output
+
+        self.setStatus(self.success_message, self.bucket_success)
+        return output
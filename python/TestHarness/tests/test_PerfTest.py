@@ -0,0 +1,14 @@
+import subprocess
+from TestHarnessTestCase import TestHarnessTestCase
+
+class TestHarnessTester(TestHarnessTestCase):
+    def testPerfTest(self):
+        """
+        Test for PerfTest baselines
+        """
+        with self.assertRaises(subprocess.CalledProcessError) as cm:
+            self.runTests('-i', 'perf')
+
+        e = cm.exception
+        self.assertRegexpMatches(e.output, r'test_harness\.perf_pass.*?OK')
+        self.assertRegexpMatches(e.output, r'test_harness\.perf_regression.*?FAILED \(PERF REGRESSION\)')
@@ -0,0 +1,42 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ADMATDIFFUSIONTEST_H
+#define ADMATDIFFUSIONTEST_H
+
+#include "ADKernel.h"
+#include "MaterialProperty.h"
+
+// Forward Declaration
+class ADMatDiffusionTest;
+
+template <>
+InputParameters validParams<ADMatDiffusionTest>();
+
+/**
+ * Diffusion with a diffusivity material property that carries derivatives, for testing the
+ * Jacobians of ADKernel
+ */
+class ADMatDiffusionTest : public ADKernel
+{
+public:
+  ADMatDiffusionTest(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpADResidual() override;
+
+  const MaterialProperty<ADReal> & _diffusivity;
+};
+
+#endif // ADMATDIFFUSIONTEST_H
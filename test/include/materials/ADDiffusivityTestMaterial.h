@@ -0,0 +1,43 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ADDIFFUSIVITYTESTMATERIAL_H
+#define ADDIFFUSIVITYTESTMATERIAL_H
+
+#include "Material.h"
+
+// Forward Declarations
+class ADDiffusivityTestMaterial;
+
+template <>
+InputParameters validParams<ADDiffusivityTestMaterial>();
+
+/**
+ * Declares the diffusivity 1 + u^2 + exp(v) as a material property that carries its derivatives
+ * with respect to the degrees of freedom of u and v
+ */
+class ADDiffusivityTestMaterial : public Material
+{
+public:
+  ADDiffusivityTestMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  MaterialProperty<ADReal> & _diffusivity;
+  const ADVariableValue & _u;
+  const ADVariableValue & _v;
+};
+
+#endif // ADDIFFUSIVITYTESTMATERIAL_H
@@ -0,0 +1,69 @@
+# u diffuses slowly, v relaxes quickly towards u and is subcycled
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./u_time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./u_diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./v_time]
+    type = TimeDerivative
+    variable = v
+  [../]
+  [./v_reaction]
+    type = Reaction
+    variable = v
+  [../]
+  [./v_source]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./v_average]
+    type = ElementAverageValue
+    variable = v
+  [../]
+[]
+
+[Executioner]
+  type = MultirateTransient
+  fast_variables = v
+  substeps = 4
+  num_steps = 3
+  dt = 0.1
+  solve_type = NEWTON
+[]
@@ -0,0 +1,76 @@
+###########################################################
+# Checks the Jacobian an ADKernel computes from a material
+# property that depends on two variables.
+###########################################################
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Functions]
+  [./u_IC_fn]
+    type = ParsedFunction
+    value = 'x + y'
+  [../]
+  [./v_IC_fn]
+    type = ParsedFunction
+    value = 'sin(x)'
+  [../]
+[]
+
+[ICs]
+  [./u_IC]
+    type = FunctionIC
+    variable = u
+    function = u_IC_fn
+  [../]
+  [./v_IC]
+    type = FunctionIC
+    variable = v
+    function = v_IC_fn
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = ADMatDiffusionTest
+    variable = u
+  [../]
+  # add a dummy kernel for v to prevent singular Jacobian
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+[]
+
+[Materials]
+  [./diffusivity]
+    type = ADDiffusivityTestMaterial
+    u = u
+    v = v
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+    solve_type = newton
+    petsc_options_iname = '-snes_type -snes_test_err'
+    petsc_options_value = 'test       1e-10'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
@@ -0,0 +1,65 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = 'diff'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  # Does not consume any material property, so the face material is not computed on this side
+  [./right]
+    type = NeumannBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./counter]
+    type = IncrementMaterial
+    prop_names = 'diff'
+    prop_values = '1'
+    block = 0
+    compute_on_demand = true
+  [../]
+[]
+
+[Postprocessors]
+  # The face material counts its evaluations in mat_prop
+  [./flux]
+    type = SideFluxIntegral
+    variable = u
+    boundary = right
+    diffusivity = mat_prop
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+[]
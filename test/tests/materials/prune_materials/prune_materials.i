@@ -0,0 +1,66 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = 'diff'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./diff]
+    type = GenericConstantMaterial
+    prop_names = 'diff'
+    prop_values = '1'
+    block = 0
+  [../]
+  # Only consumed by the postprocessor, so it is computed once per quadrature point at the end
+  [./counter]
+    type = IncrementMaterial
+    prop_names = 'unused'
+    prop_values = '1'
+    block = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./calls]
+    type = ElementIntegralMaterialProperty
+    mat_prop = mat_prop
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  csv = true
+[]
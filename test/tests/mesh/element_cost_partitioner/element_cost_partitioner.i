@@ -0,0 +1,74 @@
+###########################################################
+# This test repartitions the mesh during a transient using
+# the measured residual evaluation time of each element as
+# the METIS element weights. The imbalance threshold of 1
+# ensures that repartitioning is triggered.
+###########################################################
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  partitioner = linear
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./proc_id]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./proc_id]
+    type = ProcessorIDAux
+    variable = proc_id
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.1
+  solve_type = NEWTON
+
+  repartition_interval = 2
+  repartition_imbalance = 1
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,59 @@
+# Renumbers the elements and nodes along a space-filling curve before the
+# degrees of freedom are distributed. The linear solution, and thus the
+# integral of u, does not depend on the numbering.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 16
+  ny = 12
+  element_ordering = hilbert
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+  [../]
+  [./center]
+    type = PointValue
+    variable = u
+    point = '0.5 0.5 0'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  csv = true
+[]
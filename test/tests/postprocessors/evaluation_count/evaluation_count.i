@@ -0,0 +1,93 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = diffusivity
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./v]
+    type = FunctionAux
+    variable = v
+    function = t
+    execute_on = timestep_end
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./mat]
+    type = GenericConstantMaterial
+    prop_names = 'diffusivity'
+    prop_values = '1'
+  [../]
+[]
+
+[Postprocessors]
+  [./aux_total]
+    type = EvaluationCount
+    counter = 'aux evaluations (TIMESTEP_END)'
+  [../]
+  [./aux_increment]
+    type = EvaluationCount
+    counter = 'aux evaluations (TIMESTEP_END)'
+    mode = increment
+  [../]
+  [./materials]
+    type = EvaluationCount
+    counter = 'material evaluations (element)'
+  [../]
+  [./residuals]
+    type = EvaluationCount
+    counter = 'residual evaluations'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
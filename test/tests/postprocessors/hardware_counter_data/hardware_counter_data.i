@@ -0,0 +1,74 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[MeshModifiers]
+  [./right_block]
+    type = SubdomainBoundingBox
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./residual_ipc]
+    type = HardwareCounterData
+    loop = ComputeResidualThread
+  [../]
+  [./residual_cache_miss_rate]
+    type = HardwareCounterData
+    loop = ComputeResidualThread
+    column = cache_miss_rate
+  [../]
+  [./jacobian_block_1_cycles]
+    type = HardwareCounterData
+    loop = ComputeJacobianThread
+    block = 1
+    column = cycles
+  [../]
+  [./samples]
+    type = HardwareCounterData
+    column = samples
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  solve_type = 'NEWTON'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,88 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./mat]
+    type = GenericConstantMaterial
+    prop_names = 'diffusivity'
+    prop_values = '1'
+  [../]
+[]
+
+[Postprocessors]
+  [./diff_residual_calls]
+    type = ObjectTimingData
+    object = diff
+    method = computeResidual
+    column = n_calls
+  [../]
+  [./diff_residual_time]
+    type = ObjectTimingData
+    object = diff
+    method = computeResidual
+  [../]
+  [./diff_jacobian_average_time]
+    type = ObjectTimingData
+    object = diff
+    method = computeJacobian
+    column = average_time
+  [../]
+  [./mat_time]
+    type = ObjectTimingData
+    object = mat
+    value_type = max_process
+  [../]
+  [./average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  [./average_execute_calls]
+    type = ObjectTimingData
+    object = average
+    method = execute
+    column = n_calls
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
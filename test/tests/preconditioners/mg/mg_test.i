@@ -0,0 +1,44 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+  uniform_refine = 2
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+
+  # Geometric multigrid on the uniform refinement levels of the mesh
+  petsc_options = '-pc_mg_galerkin'
+  petsc_options_iname = '-pc_type -pc_mg_levels'
+  petsc_options_value = 'mg 3'
+[]
@@ -0,0 +1,83 @@
+# Same as part1.i, but the final state is kept in a shared memory snapshot instead of a checkpoint
+# snapshot_part2.i restarts from it and must reproduce out_part2.e
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = -1
+  xmax = 1
+  ymin = -1
+  ymax = 1
+  nx = 20
+  ny = 20
+  parallel_type = replicated
+[]
+
+[Functions]
+  [./exact_fn]
+    type = ParsedFunction
+    value = t*((x*x)+(y*y))
+  [../]
+
+  [./forcing_fn]
+    type = ParsedFunction
+    value = -4+(x*x+y*y)
+  [../]
+[]
+
+[Variables]
+  active = 'u'
+
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  active = 'ie diff ffn'
+
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+
+  [./ffn]
+    type = UserForcingFunction
+    variable = u
+    function = forcing_fn
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = '0 1 2 3'
+    function = exact_fn
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  dt = 0.2
+  start_time = 0
+  num_steps = 5
+[]
+
+[Outputs]
+  file_base = out_snapshot_part1
+  [./snapshot]
+    type = SharedMemorySnapshot
+    snapshot_name = moose_restart_snapshot
+  [../]
+[]
@@ -0,0 +1,72 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = -1
+  xmax = 1
+  ymin = -1
+  ymax = 1
+  nx = 20
+  ny = 20
+  parallel_type = replicated
+[]
+
+[Functions]
+  [./exact_fn]
+    type = ParsedFunction
+    value = ((x*x)+(y*y))
+  [../]
+
+  [./forcing_fn]
+    type = ParsedFunction
+    value = -4
+  [../]
+[]
+
+[Variables]
+  active = 'u'
+
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  active = 'diff ffn'
+
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+
+  [./ffn]
+    type = UserForcingFunction
+    variable = u
+    function = forcing_fn
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = '0 1 2 3'
+    function = exact_fn
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  file_base = out_snapshot_part2
+  exodus = true
+[]
+
+[Problem]
+  restart_snapshot = moose_restart_snapshot
+[]
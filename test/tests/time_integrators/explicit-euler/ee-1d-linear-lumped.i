@@ -0,0 +1,104 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = -1
+  xmax = 1
+  nx = 200
+  elem_type = EDGE2
+[]
+
+[Functions]
+  [./ic]
+    type = ParsedFunction
+    value = 0
+  [../]
+
+  [./forcing_fn]
+    type = ParsedFunction
+    value = x
+  [../]
+
+  [./exact_fn]
+    type = ParsedFunction
+    value = t*x
+  [../]
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+
+    [./InitialCondition]
+      type = FunctionIC
+      function = ic
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+    lumping = true
+    implicit = true
+  [../]
+
+  [./diff]
+    type = Diffusion
+    variable = u
+    implicit = false
+  [../]
+
+  [./ffn]
+    type = UserForcingFunction
+    variable = u
+    function = forcing_fn
+    implicit = false
+  [../]
+[]
+
+[BCs]
+  active = 'all'
+
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = '0 1'
+    function = exact_fn
+    implicit = true
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_err]
+    type = ElementL2Error
+    variable = u
+    function = exact_fn
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'LINEAR'
+
+  # Diagonal updates with the lumped mass instead of linear solves, the TimeDerivative kernel
+  # lumps its Jacobian so the result matches the solves
+  [./TimeIntegrator]
+    type = ExplicitEuler
+    solve_type = lumped
+  [../]
+
+  start_time = 0.0
+  num_steps = 20
+  dt = 0.00005
+[]
+
+[Outputs]
+  file_base = ee-1d-linear_out
+  exodus = true
+  [./console]
+    type = Console
+    max_rows = 10
+  [../]
+[]
@@ -0,0 +1,76 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./from_sub]
+    type = ConstantVectorPostprocessor
+    value = '0 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    positions = '0.2 0.2 0 0.7 0.7 0'
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    input_files = 'sub0.i sub1.i'
+  [../]
+[]
+
+[Transfers]
+  [./vpp_transfer]
+    type = MultiAppVectorPostprocessorTransfer
+    direction = from_multiapp
+    multi_app = sub
+    postprocessors = 'num_elems num_nodes'
+    vector_postprocessor = from_sub
+  [../]
+[]
@@ -0,0 +1,70 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  partitioner = linear
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./load]
+    type = ProcessorLoadData
+  [../]
+[]
+
+[Postprocessors]
+  [./residual_imbalance]
+    type = LoadImbalance
+    vectorpostprocessor = load
+    vector_name = residual_time
+  [../]
+  [./element_imbalance]
+    type = LoadImbalance
+    vectorpostprocessor = load
+    vector_name = elements
+    incremental = false
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]